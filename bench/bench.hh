@@ -0,0 +1,154 @@
+// COPYRIGHT (C) HARRY CLARK 2025
+// A LIGHTWEIGHT IMPLEMENTATION OF COMMON UTILITIES
+
+// THIS FILE PERTAINS TOWARDS A MINIMAL MICRO-BENCHMARK HARNESS
+// EACH SUITE RUNS IT'S BODY A FIXED NUMBER OF TIMES AND REPORTS THE AVERAGE COST PER OPERATION
+//
+// EVERY RUN IS ALSO KEPT AS A RECORD - NANOSECONDS, TIMESTAMP COUNTER TICKS AND (WHEN ASKED FOR AND PERMITTED)
+// HARDWARE COUNTERS PER OPERATION - SO THAT A WHOLE SESSION CAN BE WRITTEN OUT AS JSON AND DIFFED AGAINST ANOTHER
+
+#ifndef BENCH_HH
+#define BENCH_HH
+
+// NESTED INCLUDES
+
+#include <common.hh>
+#include <fmt/core.h>
+
+// SYSTEM INCLUDES
+
+#include <array>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+#endif
+
+namespace noodle
+{
+    namespace bench
+    {
+        // THE HARDWARE COUNTERS SAMPLED AROUND EACH RUN WHEN --PERF IS GIVEN (SEE COUNTERS.CC)
+        enum PERF_COUNTER : U32
+        {
+            PERF_CYCLES,
+            PERF_INSTRUCTIONS,
+            PERF_BRANCH_MISSES,
+            PERF_CACHE_MISSES,
+            PERF_COUNT
+        };
+
+        static constexpr const char* PERF_NAMES[PERF_COUNT] = { "cycles", "instructions", "branch_misses", "cache_misses" };
+
+        bool PERF_OPEN();
+        void PERF_CLOSE();
+        bool PERF_ACTIVE();
+        void PERF_START();
+        void PERF_STOP(std::array<U64, PERF_COUNT>& COUNTS);
+
+        // ONE TIMED RUN, WITH EVERY FIGURE NORMALISED TO A SINGLE OPERATION
+        struct BENCH_RECORD
+        {
+            std::string SUITE;
+            std::string NAME;
+            U64 OPS;
+            double NS;
+            double TICKS;
+            bool HAS_COUNTERS;
+            std::array<double, PERF_COUNT> COUNTERS;
+        };
+
+        inline std::vector<BENCH_RECORD>& RECORDS()
+        {
+            static std::vector<BENCH_RECORD> LIST;
+            return LIST;
+        }
+
+        // THE SUITE WHICH SUBSEQUENT RECORDS ARE FILED UNDER, SET BY MAIN BEFORE EACH SUITE RUNS
+        inline std::string& CURRENT_SUITE()
+        {
+            static std::string SUITE;
+            return SUITE;
+        }
+
+        // THE HOST'S TIMESTAMP COUNTER - ON X86 THIS TICKS AT A FIXED REFERENCE RATE RATHER THAN THE CORE CLOCK,
+        // SO IS ONLY COMPARABLE BETWEEN RUNS ON THE SAME MACHINE. HOSTS WITHOUT ONE REPORT ZERO
+        static inline U64 TICKS()
+        {
+            #if defined(__x86_64__) || defined(__i386__)
+                return __rdtsc();
+            #elif defined(__aarch64__)
+                U64 VALUE;
+                asm volatile("mrs %0, cntvct_el0" : "=r"(VALUE));
+                return VALUE;
+            #else
+                return 0;
+            #endif
+        }
+
+        // KEEP A VALUE ALIVE WITHOUT THE COMPILER BEING ABLE TO SEE THROUGH IT
+        template<typename T>
+        static inline void DO_NOT_OPTIMISE(const T& VALUE)
+        {
+            asm volatile("" : : "r,m"(VALUE) : "memory");
+        }
+
+        // RUN A BODY OPS TIMES, WHERE THE BODY IS HANDED THE CURRENT ITERATION
+        // A SHORT WARM UP PASS IS DISCARDED BEFORE TIMING TO AVOID MEASURING COLD CACHES
+        template<typename FN>
+        static inline double RUN(const char* NAME, U64 OPS, FN&& BODY)
+        {
+            for(U64 INDEX = 0; INDEX < OPS / 16; INDEX++)
+                BODY(INDEX);
+
+            std::array<U64, PERF_COUNT> COUNTS{};
+
+            PERF_START();
+            const auto START = std::chrono::steady_clock::now();
+            const U64 START_TICKS = TICKS();
+
+            for(U64 INDEX = 0; INDEX < OPS; INDEX++)
+                BODY(INDEX);
+
+            const U64 END_TICKS = TICKS();
+            const auto END = std::chrono::steady_clock::now();
+            PERF_STOP(COUNTS);
+
+            const double SCALE = 1.0 / static_cast<double>(OPS);
+
+            BENCH_RECORD RECORD{ CURRENT_SUITE(), NAME, OPS,
+                                 std::chrono::duration<double, std::nano>(END - START).count() * SCALE,
+                                 static_cast<double>(END_TICKS - START_TICKS) * SCALE,
+                                 PERF_ACTIVE(), {} };
+
+            for(U32 INDEX = 0; INDEX < PERF_COUNT; INDEX++)
+                RECORD.COUNTERS[INDEX] = static_cast<double>(COUNTS[INDEX]) * SCALE;
+
+            if(RECORD.HAS_COUNTERS)
+            {
+                fmt::print("{:<40} {:>10.3f} NS/OP {:>10.1f} TICKS/OP {:>8.1f} CYC {:>8.1f} INS {:>7.3f} BR-MISS {:>7.3f} LLC-MISS\n",
+                           NAME, RECORD.NS, RECORD.TICKS, RECORD.COUNTERS[PERF_CYCLES], RECORD.COUNTERS[PERF_INSTRUCTIONS],
+                           RECORD.COUNTERS[PERF_BRANCH_MISSES], RECORD.COUNTERS[PERF_CACHE_MISSES]);
+            }
+            else
+            {
+                fmt::print("{:<40} {:>10.3f} NS/OP {:>10.1f} TICKS/OP\n", NAME, RECORD.NS, RECORD.TICKS);
+            }
+
+            RECORDS().push_back(std::move(RECORD));
+            return RECORDS().back().NS;
+        }
+
+        // EACH SUITE IS DEFINED IN IT'S OWN TRANSLATION UNIT
+        void BENCH_BUS();
+        void BENCH_TLB();
+        void BENCH_MMU();
+        void BENCH_SYNC();
+        void BENCH_ENDIAN();
+        void BENCH_LOG();
+    }
+}
+
+#endif
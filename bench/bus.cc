@@ -0,0 +1,252 @@
+// COPYRIGHT (C) HARRY CLARK 2025
+// A LIGHTWEIGHT IMPLEMENTATION OF COMMON UTILITIES
+
+// MEMORY BUS BENCHMARKS - RAM FAST PATH VERSUS HANDLER DISPATCH
+
+// NESTED INCLUDES
+
+#include "bench.hh"
+#include <noodle/memory.hh>
+
+// SYSTEM INCLUDES
+
+#include <functional>
+
+using namespace fujiko::memory;
+
+namespace
+{
+    // STAND-IN DEVICE WITH A SINGLE REGISTER
+    struct DEVICE
+    {
+        U32 REGISTER = 0;
+
+        U32 READ_32(U32 ADDRESS) { return REGISTER ^ ADDRESS; }
+        void WRITE_32(U32 ADDRESS, U32 VALUE) { REGISTER = VALUE; }
+    };
+
+    // RAW HANDLERS FOR EVERY ACCESS WIDTH, SO THAT EACH WIDTH OF A HANDLER PAGE REALLY DISPATCHES
+    template<typename T>
+    static T RAW_READ(U32 ADDRESS, void* CTX)
+    {
+        return static_cast<T>(static_cast<DEVICE*>(CTX)->REGISTER ^ ADDRESS);
+    }
+
+    template<typename T>
+    static void RAW_WRITE(U32 ADDRESS, T VALUE, void* CTX)
+    {
+        static_cast<DEVICE*>(CTX)->REGISTER = VALUE;
+    }
+
+    static U32 RAW_READ_32(U32 ADDRESS, void* CTX) { return RAW_READ<U32>(ADDRESS, CTX); }
+    static void RAW_WRITE_32(U32 ADDRESS, U32 VALUE, void* CTX) { RAW_WRITE<U32>(ADDRESS, VALUE, CTX); }
+
+    // A READ AND A WRITE OF ONE WIDTH, WALKING A 64KB RANGE FROM BASE AT THAT WIDTH'S ALIGNMENT
+    template<typename T>
+    static void RUN_WIDTH(MEMORY_BUS& BUS, U32 BASE, const char* WHERE)
+    {
+        static constexpr U64 OPS = 1U << 24;
+        static constexpr U32 MASK = 0xFFFF & ~static_cast<U32>(sizeof(T) - 1);
+
+        noodle::bench::RUN(fmt::format("BUS READ<U{}> {}", sizeof(T) * 8, WHERE).c_str(), OPS, [&](U64 INDEX)
+        {
+            noodle::bench::DO_NOT_OPTIMISE(BUS.READ<T>(BASE + (static_cast<U32>(INDEX * sizeof(T)) & MASK)));
+        });
+
+        noodle::bench::RUN(fmt::format("BUS WRITE<U{}> {}", sizeof(T) * 8, WHERE).c_str(), OPS, [&](U64 INDEX)
+        {
+            BUS.WRITE<T>(BASE + (static_cast<U32>(INDEX * sizeof(T)) & MASK), static_cast<T>(INDEX));
+        });
+    }
+
+    // THE PREVIOUS TYPE-ERASED PAGE LAYOUT, KEPT HERE PURELY AS A POINT OF COMPARISON
+    struct FUNCTION_PAGE
+    {
+        U8* ARRAY = nullptr;
+        void* CTX = nullptr;
+        bool WRITEABLE = false;
+        bool READONLY = false;
+
+        std::function<U8(U32, void*)> READ_8;
+        std::function<U16(U32, void*)> READ_16;
+        std::function<U32(U32, void*)> READ_32;
+
+        std::function<void(U32, U8, void*)> WRITE_8;
+        std::function<void(U32, U16, void*)> WRITE_16;
+        std::function<void(U32, U32, void*)> WRITE_32;
+    };
+}
+
+void noodle::bench::BENCH_BUS()
+{
+    static constexpr U64 OPS = 1U << 24;
+    static constexpr U32 MMIO_BASE = 0x00100000;
+
+    MEMORY_BUS BUS;
+    DEVICE DEV;
+
+    BUS.MAP_ARRAY(0x00000000, 0x0000FFFF, MEMORY_ARRAY, true).REPORT();
+    BUS.MAP_HANDLER(MMIO_BASE, MMIO_BASE + 0xFFFF, &DEV,
+                    FUJIKO_DEVICE_HANDLER<&DEVICE::READ_32, &DEVICE::WRITE_32>()).REPORT();
+    BUS.MAP_HANDLER(MMIO_BASE + 0x10000, MMIO_BASE + 0x1FFFF, &DEV,
+                    FUJIKO_HANDLER<U8>{ RAW_READ<U8>, RAW_WRITE<U8> },
+                    FUJIKO_HANDLER<U16>{ RAW_READ<U16>, RAW_WRITE<U16> },
+                    FUJIKO_HANDLER<U32>{ RAW_READ_32, RAW_WRITE_32 }).REPORT();
+
+    fmt::print("PAGE ENTRY: {} BYTES (STD::FUNCTION: {} BYTES)\n", sizeof(BUS.PAGES[0]), sizeof(FUNCTION_PAGE));
+    fmt::print("HANDLER RECORD: {} BYTES\n", sizeof(MEMORY_BUS::MEMORY_HANDLERS));
+    fmt::print("PAGE TABLE: {} KB (STD::FUNCTION: {} KB)\n\n",
+               (sizeof(BUS.PAGES[0]) * MEMORY_BUS::PAGE_COUNT) / 1024,
+               (sizeof(FUNCTION_PAGE) * MEMORY_BUS::PAGE_COUNT) / 1024);
+
+    // EVERY WIDTH AGAINST PLAIN RAM, THEN THE SAME AGAINST A PAGE OF RAW HANDLERS
+    RUN_WIDTH<U8>(BUS, 0x00000000, "RAM");
+    RUN_WIDTH<U16>(BUS, 0x00000000, "RAM");
+    RUN_WIDTH<U32>(BUS, 0x00000000, "RAM");
+
+    RUN_WIDTH<U8>(BUS, MMIO_BASE + 0x10000, "RAW HANDLER");
+    RUN_WIDTH<U16>(BUS, MMIO_BASE + 0x10000, "RAW HANDLER");
+    RUN_WIDTH<U32>(BUS, MMIO_BASE + 0x10000, "RAW HANDLER");
+
+    // THE CHECKED READ - A RESULT CARRYING THE VALUE, AND ONE MORE TEST OF THE PAGE ENTRY
+    RUN("BUS TRY_READ<U32> RAM", OPS, [&](U64 INDEX)
+    {
+        DO_NOT_OPTIMISE(BUS.TRY_READ<U32>(static_cast<U32>(INDEX << 2) & 0xFFFC).VALUE());
+    });
+
+    RUN("BUS READ<U32> BOUND HANDLER", OPS, [&](U64 INDEX)
+    {
+        DO_NOT_OPTIMISE(BUS.READ<U32>(MMIO_BASE + (static_cast<U32>(INDEX << 2) & 0xFFFC)));
+    });
+
+#if NOODLE_BUS_PROFILE
+    // THE PROFILER'S COST PER ACCESS - COUNTERS ALONE, THEN COUNTERS WITH THE TRACE RING
+    const double IDLE_NS = RUN("BUS READ<U32> RAM (PROFILE BUILT, IDLE)", OPS, [&](U64 INDEX)
+    {
+        DO_NOT_OPTIMISE(BUS.READ<U32>(static_cast<U32>(INDEX << 2) & 0xFFFC));
+    });
+
+    for(const std::size_t RING : { std::size_t{0}, std::size_t{1} << 16 })
+    {
+        BUS.START_PROFILE(RING);
+
+        const double PROFILED_NS = RUN(RING ? "BUS READ<U32> RAM (PROFILE + TRACE)" : "BUS READ<U32> RAM (PROFILE)", OPS, [&](U64 INDEX)
+        {
+            DO_NOT_OPTIMISE(BUS.READ<U32>(static_cast<U32>(INDEX << 2) & 0xFFFC));
+        });
+
+        BUS.STOP_PROFILE();
+        fmt::print("PROFILER: {:+.3f} NS/OP\n", PROFILED_NS - IDLE_NS);
+    }
+#endif
+
+    // EQUIVALENT DISPATCH THROUGH A STD::FUNCTION TABLE
+    std::vector<FUNCTION_PAGE> FUNCTION_PAGES(MEMORY_BUS::PAGE_COUNT);
+    FUNCTION_PAGES[(MMIO_BASE + 0x10000) >> MEMORY_BUS::PAGE_BITS].CTX = &DEV;
+    FUNCTION_PAGES[(MMIO_BASE + 0x10000) >> MEMORY_BUS::PAGE_BITS].READ_32 = RAW_READ_32;
+
+    RUN("STD::FUNCTION READ<U32> HANDLER", OPS, [&](U64 INDEX)
+    {
+        const U32 ADDRESS = MMIO_BASE + 0x10000 + (static_cast<U32>(INDEX << 2) & 0xFFFC);
+        const FUNCTION_PAGE& PAGE = FUNCTION_PAGES[ADDRESS >> MEMORY_BUS::PAGE_BITS];
+        DO_NOT_OPTIMISE(PAGE.READ_32 ? PAGE.READ_32(ADDRESS, PAGE.CTX) : 0);
+    });
+
+    // A WATCHPOINT ON ONE PAGE MUST LEAVE EVERY OTHER PAGE ON THE FAST PATH
+    const double UNWATCHED_NS = RUN("BUS READ<U32> RAM (NO WATCH)", OPS, [&](U64 INDEX)
+    {
+        DO_NOT_OPTIMISE(BUS.READ<U32>(static_cast<U32>(INDEX << 2) & 0xFFFC));
+    });
+
+    const U32 WATCH = BUS.ADD_WATCH(MMIO_BASE, MMIO_BASE + 3, watch::READ | watch::WRITE,
+                                    [](const FUJIKO_WATCH_EVENT&, void*) {});
+
+    const double WATCHED_NS = RUN("BUS READ<U32> RAM (WATCH ELSEWHERE)", OPS, [&](U64 INDEX)
+    {
+        DO_NOT_OPTIMISE(BUS.READ<U32>(static_cast<U32>(INDEX << 2) & 0xFFFC));
+    });
+
+    BUS.REMOVE_WATCH(WATCH);
+    fmt::print("WATCHPOINT ELSEWHERE: {:+.3f} NS/OP\n", WATCHED_NS - UNWATCHED_NS);
+
+    // RAM SHARING IT'S PAGE WITH A DEVICE IS REACHED THROUGH THE SPLIT PAGE'S REGION MAP
+    BUS.MAP_HANDLER(0x0000FF00, 0x0000FFFF, &DEV, FUJIKO_HANDLER<U32>{ RAW_READ_32, RAW_WRITE_32 }).REPORT();
+
+    const double SPLIT_NS = RUN("BUS READ<U32> RAM (SPLIT PAGE)", OPS, [&](U64 INDEX)
+    {
+        DO_NOT_OPTIMISE(BUS.READ<U32>(static_cast<U32>(INDEX << 2) & 0xFEFC));
+    });
+
+    fmt::print("SPLIT PAGE RAM: {:+.3f} NS/OP\n", SPLIT_NS - UNWATCHED_NS);
+
+    // A REMAP OF ONE PAGE, FLIPPING BETWEEN TWO ARRAYS SO THAT EVERY CALL REALLY DOES REWRITE THE ENTRY
+    alignas(64) static std::array<U8, 0x10000> OTHER;
+
+    RUN("MAP_ARRAY 64KB REMAP", 1U << 16, [&](U64 INDEX)
+    {
+        BUS.MAP_ARRAY(0x00020000, 0x0002FFFF, (INDEX & 1) ? OTHER : MEMORY_ARRAY, true).REPORT();
+    });
+
+    // BULK TRANSFERS OVER A 256KB RANGE (FOUR CONTIGUOUS PAGES), AGAINST THE EQUIVALENT BYTE LOOP
+    static constexpr U32 BLOCK = 0x40000;
+    static constexpr U64 BLOCK_OPS = 1U << 10;
+    static std::vector<U8> HOST(BLOCK);
+    alignas(64) static std::array<U8, BLOCK> RAM;
+
+    BUS.MAP_ARRAY(0x00000000, BLOCK - 1, RAM, true).REPORT();
+
+    const double LOOP_NS = RUN("BYTE LOOP WRITE<U8> 256KB", BLOCK_OPS / 16, [&](U64 INDEX)
+    {
+        for(U32 OFFSET = 0; OFFSET < BLOCK; OFFSET++)
+            BUS.WRITE<U8>(OFFSET, HOST[OFFSET]);
+    });
+
+    const double BLOCK_NS = RUN("WRITE_BLOCK 256KB", BLOCK_OPS, [&](U64 INDEX)
+    {
+        BUS.WRITE_BLOCK(0, HOST.data(), BLOCK);
+    });
+
+    RUN("READ_BLOCK 256KB", BLOCK_OPS, [&](U64 INDEX)
+    {
+        BUS.READ_BLOCK(0, HOST.data(), BLOCK);
+        DO_NOT_OPTIMISE(HOST[0]);
+    });
+
+    RUN("FILL 256KB", BLOCK_OPS, [&](U64 INDEX)
+    {
+        BUS.FILL(0, static_cast<U8>(INDEX), BLOCK);
+    });
+
+    RUN("COPY 128KB", BLOCK_OPS, [&](U64 INDEX)
+    {
+        BUS.COPY(BLOCK / 2, 0, BLOCK / 2);
+    });
+
+    fmt::print("WRITE_BLOCK: {:.2f} GB/S ({:.1f}X THE BYTE LOOP)\n", BLOCK / BLOCK_NS, LOOP_NS / BLOCK_NS);
+
+    // ROLLBACK - A FRAME WHICH TOUCHES A FEW KB OF THE 256KB RANGE, SNAPSHOT THEN RESTORED
+    // AGAINST COPYING THE WHOLE RANGE OUT AND BACK IN
+    for(const U32 GRANULE : { MEMORY_BUS::PAGE_BITS, 6U })
+    {
+        BUS.ENABLE_TRACKING(GRANULE);
+        const U32 ID = BUS.SNAPSHOT();
+
+        RUN(GRANULE == 6 ? "SNAPSHOT + RESTORE 4KB DIRTY (64B)" : "SNAPSHOT + RESTORE 4KB DIRTY (PAGE)", BLOCK_OPS, [&](U64 INDEX)
+        {
+            for(U32 OFFSET = 0; OFFSET < 0x1000; OFFSET += 4)
+                BUS.WRITE<U32>(OFFSET, static_cast<U32>(INDEX));
+
+            BUS.RESTORE(ID);
+        });
+
+        BUS.DISABLE_TRACKING();
+    }
+
+    RUN("FULL COPY 256KB OUT + IN", BLOCK_OPS, [&](U64 INDEX)
+    {
+        BUS.READ_BLOCK(0, HOST.data(), BLOCK);
+        BUS.WRITE_BLOCK(0, HOST.data(), BLOCK);
+    });
+
+    fmt::print("\n");
+}
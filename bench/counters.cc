@@ -0,0 +1,119 @@
+// COPYRIGHT (C) HARRY CLARK 2025
+// A LIGHTWEIGHT IMPLEMENTATION OF COMMON UTILITIES
+
+// HARDWARE COUNTERS FOR THE BENCHMARK HARNESS, READ THROUGH LINUX'S PERF_EVENT_OPEN
+// THE COUNTERS ARE OPENED AS ONE GROUP, SO THEY ARE SCHEDULED ONTO THE PMU TOGETHER AND COVER THE SAME INTERVAL
+//
+// THEY ARE STRICTLY OPTIONAL - A HOST WITHOUT PERF, A RESTRICTIVE PERF_EVENT_PARANOID OR A VIRTUAL MACHINE
+// WITHOUT A VIRTUALISED PMU SIMPLY LEAVES THEM CLOSED, AND EVERY RUN FALLS BACK TO TIME AND TICKS ALONE
+
+// NESTED INCLUDES
+
+#include "bench.hh"
+
+#if defined(__linux__)
+
+// SYSTEM INCLUDES
+
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace
+{
+    static int DESCRIPTORS[noodle::bench::PERF_COUNT] = { -1, -1, -1, -1 };
+
+    static const U64 EVENTS[noodle::bench::PERF_COUNT] =
+    {
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_BRANCH_MISSES,
+        PERF_COUNT_HW_CACHE_MISSES
+    };
+
+    // USER SPACE ONLY, SO THAT THE FIGURES DON'T DEPEND ON WHETHER THE KERNEL LETS US SEE IT'S OWN TIME
+    static int OPEN_EVENT(U64 EVENT, int LEADER)
+    {
+        perf_event_attr ATTR;
+        std::memset(&ATTR, 0, sizeof(ATTR));
+
+        ATTR.size = sizeof(ATTR);
+        ATTR.type = PERF_TYPE_HARDWARE;
+        ATTR.config = EVENT;
+        ATTR.disabled = LEADER < 0;
+        ATTR.exclude_kernel = 1;
+        ATTR.exclude_hv = 1;
+        ATTR.read_format = PERF_FORMAT_GROUP;
+
+        return static_cast<int>(::syscall(SYS_perf_event_open, &ATTR, 0, -1, LEADER, 0));
+    }
+}
+
+bool noodle::bench::PERF_OPEN()
+{
+    for(U32 INDEX = 0; INDEX < PERF_COUNT; INDEX++)
+    {
+        DESCRIPTORS[INDEX] = OPEN_EVENT(EVENTS[INDEX], INDEX == 0 ? -1 : DESCRIPTORS[0]);
+
+        // A PARTIAL GROUP WOULD REPORT COUNTERS WHICH DON'T AGREE WITH EACH OTHER - ALL OR NOTHING
+        if(DESCRIPTORS[INDEX] < 0)
+        {
+            PERF_CLOSE();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void noodle::bench::PERF_CLOSE()
+{
+    for(int& FD : DESCRIPTORS)
+    {
+        if(FD >= 0) ::close(FD);
+        FD = -1;
+    }
+}
+
+bool noodle::bench::PERF_ACTIVE()
+{
+    return DESCRIPTORS[0] >= 0;
+}
+
+void noodle::bench::PERF_START()
+{
+    if(!PERF_ACTIVE()) return;
+
+    ::ioctl(DESCRIPTORS[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ::ioctl(DESCRIPTORS[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+void noodle::bench::PERF_STOP(std::array<U64, PERF_COUNT>& COUNTS)
+{
+    if(!PERF_ACTIVE()) return;
+
+    ::ioctl(DESCRIPTORS[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    // A GROUP READ IS THE NUMBER OF EVENTS FOLLOWED BY EACH VALUE, IN THE ORDER THEY WERE OPENED
+    U64 BUFFER[1 + PERF_COUNT] = {};
+
+    if(::read(DESCRIPTORS[0], BUFFER, sizeof(BUFFER)) != static_cast<ssize_t>(sizeof(BUFFER)))
+        return;
+
+    for(U32 INDEX = 0; INDEX < PERF_COUNT; INDEX++)
+        COUNTS[INDEX] = BUFFER[1 + INDEX];
+}
+
+#else
+
+// NO PERF_EVENT_OPEN - THE COUNTERS ARE NEVER AVAILABLE
+
+bool noodle::bench::PERF_OPEN() { return false; }
+void noodle::bench::PERF_CLOSE() {}
+bool noodle::bench::PERF_ACTIVE() { return false; }
+void noodle::bench::PERF_START() {}
+void noodle::bench::PERF_STOP(std::array<U64, PERF_COUNT>&) {}
+
+#endif
@@ -0,0 +1,75 @@
+// COPYRIGHT (C) HARRY CLARK 2025
+// A LIGHTWEIGHT IMPLEMENTATION OF COMMON UTILITIES
+
+// BYTE ORDER BENCHMARKS - A BIG-ENDIAN BUS AGAINST THE NATIVE ONE, AND TYPED BLOCKS AGAINST PER-VALUE READS
+
+// NESTED INCLUDES
+
+#include "bench.hh"
+#include <noodle/bits.hh>
+#include <noodle/memory.hh>
+
+// SYSTEM INCLUDES
+
+#include <vector>
+
+using namespace fujiko::memory;
+
+void noodle::bench::BENCH_ENDIAN()
+{
+    static constexpr U64 OPS = 1U << 24;
+    static constexpr U64 BLOCK_OPS = 1U << 12;
+    static constexpr U32 WORDS = 0x8000;
+
+    MEMORY_BUS NATIVE;
+    BASIC_MEMORY_BUS<27, 16, FUJIKO_ENDIAN_BIG> BIG;
+    std::vector<U16> HOST(WORDS);
+
+    NATIVE.MAP_ARRAY(0x00000000, 0x0000FFFF, MEMORY_ARRAY, true).REPORT();
+    BIG.MAP_ARRAY(0x00000000, 0x0000FFFF, MEMORY_ARRAY, true).REPORT();
+
+    const double NATIVE_NS = RUN("BUS READ<U32> RAM (NATIVE)", OPS, [&](U64 INDEX)
+    {
+        DO_NOT_OPTIMISE(NATIVE.READ<U32>(static_cast<U32>(INDEX << 2) & 0xFFFC));
+    });
+
+    const double BIG_NS = RUN("BUS READ<U32> RAM (BIG)", OPS, [&](U64 INDEX)
+    {
+        DO_NOT_OPTIMISE(BIG.READ<U32>(static_cast<U32>(INDEX << 2) & 0xFFFC));
+    });
+
+    RUN("BUS WRITE<U32> RAM (BIG)", OPS, [&](U64 INDEX)
+    {
+        BIG.WRITE<U32>(static_cast<U32>(INDEX << 2) & 0xFFFC, static_cast<U32>(INDEX));
+    });
+
+    fmt::print("BIG-ENDIAN READ: {:+.3f} NS/OP\n", BIG_NS - NATIVE_NS);
+
+    // 64KB OF BIG-ENDIAN WORDS INTO HOST ORDER
+    const double LOOP_NS = RUN("READ<U16> LOOP 64KB (BIG)", BLOCK_OPS, [&](U64 INDEX)
+    {
+        for(U32 WORD = 0; WORD < WORDS; WORD++)
+            HOST[WORD] = BIG.READ<U16>(WORD << 1);
+
+        DO_NOT_OPTIMISE(HOST[0]);
+    });
+
+    const double BLOCK_NS = RUN("READ_BLOCK<U16> 64KB (BIG)", BLOCK_OPS, [&](U64 INDEX)
+    {
+        BIG.READ_BLOCK(0, HOST.data(), WORDS);
+        DO_NOT_OPTIMISE(HOST[0]);
+    });
+
+    RUN("WRITE_BLOCK<U16> 64KB (BIG)", BLOCK_OPS, [&](U64 INDEX)
+    {
+        BIG.WRITE_BLOCK(0, HOST.data(), WORDS);
+    });
+
+    RUN("SWAP_BLOCK<U16> 64KB", BLOCK_OPS, [&](U64 INDEX)
+    {
+        fujiko::bits::SWAP_BLOCK(HOST.data(), HOST.data(), WORDS);
+        DO_NOT_OPTIMISE(HOST[0]);
+    });
+
+    fmt::print("READ_BLOCK<U16>: {:.2f} GB/S ({:.1f}X THE READ LOOP)\n\n", (WORDS * 2) / BLOCK_NS, LOOP_NS / BLOCK_NS);
+}
@@ -0,0 +1,137 @@
+// COPYRIGHT (C) HARRY CLARK 2025
+// A LIGHTWEIGHT IMPLEMENTATION OF COMMON UTILITIES
+
+// LOGGING BENCHMARKS - THE COST TO THE CALLING THREAD OF A WARNING, WRITTEN SYNCHRONOUSLY,
+// FILTERED OUT, COLLAPSED AS A REPEAT, HANDED TO THE ASYNCHRONOUS BACKEND, OR RECORDED UNFORMATTED TO THE BINARY LOG
+
+// NESTED INCLUDES
+
+#include "bench.hh"
+#include <noodle/binlog.hh>
+#include <noodle/error.hh>
+
+// SYSTEM INCLUDES
+
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <unistd.h>
+
+using namespace noodle::err;
+
+namespace
+{
+    // THE PREVIOUS SYNCHRONOUS PATH, KEPT HERE PURELY AS A POINT OF COMPARISON -
+    // ONE SHARED COUNTER, A STD::STRING FOR THE MESSAGE, THEN A SECOND FORMAT FOR THE HEADER
+    static std::atomic<int> LEGACY_COUNT{0};
+
+    template<typename... ARGS>
+    static void LEGACY_PRINT(std::FILE* OUTPUT, ERROR_CATEGORY CAT, ERROR_SEVERITY SEV, const std::string& FMT_STR, ARGS&&... A)
+    {
+        const int ERR_CODE = LEGACY_COUNT.fetch_add(1);
+        const std::string MSG = fmt::format(FMT_STR, std::forward<ARGS>(A)...);
+
+        fmt::print(OUTPUT, "[{}] [{}]\nERROR: {} - {}\n\n",
+                   (SEV) == ERROR_SEVERITY::FATAL ? "FATAL" : (SEV) == ERROR_SEVERITY::CRITICAL ? "CRITICAL" :
+                   (SEV) == ERROR_SEVERITY::STD_ERROR ? "ERROR" : (SEV) == ERROR_SEVERITY::WARNING ? "WARNING" : "INFO",
+                   (CAT) == ERROR_CATEGORY::LOGIC_ERR ? "LOGIC" : (CAT) == ERROR_CATEGORY::RES_ERR ? "RESOURCE" : "CUSTOM",
+                   ERR_CODE, MSG);
+    }
+
+    static void REPORT(const char* NAME, double NS)
+    {
+        fmt::print("{:<40} {:>10.2f} M MSG/S\n", NAME, 1000.0 / NS);
+    }
+}
+
+void noodle::bench::BENCH_LOG()
+{
+    static constexpr U64 OPS = 1U << 16;
+
+    std::FILE* SINK = std::fopen("/dev/null", "w");
+    if(SINK == nullptr) return;
+
+    const double LEGACY_NS = RUN("WARNING (PREVIOUS PATH)", OPS, [&](U64 INDEX)
+    {
+        LEGACY_PRINT(SINK, ERROR_CATEGORY::CUSTOM_ERR, ERROR_SEVERITY::WARNING,
+                     "ACCESS TO 0x{:08X} FAILED", static_cast<U32>(INDEX));
+    });
+
+    // THE COUNT ALONE - ONE SHARED ATOMIC AGAINST THE CALLING THREAD'S SHARD OF THE METRICS
+    RUN("ERROR COUNT (SHARED ATOMIC)", OPS << 4, [&](U64)
+    {
+        DO_NOT_OPTIMISE(LEGACY_COUNT.fetch_add(1));
+    });
+
+    RUN("ERROR COUNT (ERROR_METRICS)", OPS << 4, [&](U64)
+    {
+        ERROR_METRICS::INSTANCE().RECORD(ERROR_CATEGORY::CUSTOM_ERR, ERROR_SEVERITY::WARNING);
+    });
+
+    SET_LOG_OUTPUT(SINK);
+
+    const double SYNC_NS = RUN("NOODLE_WARNING", OPS, [&](U64 INDEX)
+    {
+        NOODLE_WARNING("ACCESS TO 0x{:08X} FAILED", static_cast<U32>(INDEX));
+    });
+
+    SET_LOG_LEVEL(ERROR_SEVERITY::STD_ERROR);
+
+    const double FILTERED_NS = RUN("NOODLE_WARNING (FILTERED AT RUNTIME)", OPS << 8, [&](U64 INDEX)
+    {
+        NOODLE_WARNING("ACCESS TO 0x{:08X} FAILED", static_cast<U32>(INDEX));
+    });
+
+    SET_LOG_LEVEL(ERROR_SEVERITY::INFO);
+    SET_LOG_REPEAT_WINDOW(std::chrono::seconds(1));
+
+    RUN("NOODLE_WARNING (REPEATS COLLAPSED)", OPS, [&](U64)
+    {
+        NOODLE_WARNING("ACCESS TO 0x{:08X} FAILED", 0x1234U);
+    });
+
+    SET_LOG_REPEAT_WINDOW(std::chrono::nanoseconds(0));
+
+    ASYNC_LOG& LOG = ASYNC_LOG::INSTANCE();
+    LOG.START(LOG_CONFIG{ 1U << 16, LOG_OVERFLOW::BLOCK, SINK });
+
+    const double ASYNC_NS = RUN("NOODLE_WARNING (ASYNC)", OPS, [&](U64 INDEX)
+    {
+        NOODLE_WARNING("ACCESS TO 0x{:08X} FAILED", static_cast<U32>(INDEX));
+    });
+
+    LOG.STOP();
+
+    // THE BINARY LOG IS SIZED TO HOLD EVERY RECORD, SO NONE OF THE TIMED CALLS ARE DROPS
+    BINARY_LOG& BINARY = BINARY_LOG::INSTANCE();
+    char PATH[] = "/tmp/noodle_bench_XXXXXX";
+    const int FD = ::mkstemp(PATH);
+    double BINARY_NS = 0.0;
+
+    if(FD >= 0 && BINARY.OPEN(PATH, std::size_t{64} << 20))
+    {
+        BINARY_NS = RUN("NOODLE_BINARY_PRINT", OPS, [&](U64 INDEX)
+        {
+            NOODLE_BINARY_PRINT(ERROR_CATEGORY::CUSTOM_ERR, ERROR_SEVERITY::WARNING,
+                                "ACCESS TO 0x{:08X} FAILED", static_cast<U32>(INDEX));
+        });
+
+        BINARY.CLOSE();
+    }
+
+    if(FD >= 0)
+    {
+        ::close(FD);
+        std::remove(PATH);
+    }
+
+    SET_LOG_OUTPUT(nullptr);
+    std::fclose(SINK);
+
+    REPORT("PREVIOUS PATH", LEGACY_NS);
+    REPORT("NOODLE_WARNING", SYNC_NS);
+    REPORT("NOODLE_WARNING (FILTERED AT RUNTIME)", FILTERED_NS);
+    REPORT("NOODLE_WARNING (ASYNC)", ASYNC_NS);
+    if(BINARY_NS > 0.0) REPORT("NOODLE_BINARY_PRINT", BINARY_NS);
+    fmt::print("\n");
+}
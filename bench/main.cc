@@ -0,0 +1,160 @@
+// COPYRIGHT (C) HARRY CLARK 2025
+// A LIGHTWEIGHT IMPLEMENTATION OF COMMON UTILITIES
+
+// ENTRY POINT FOR THE MICRO-BENCHMARK SUITES
+// USAGE: NOODLE_BENCH [--PERF] [--JSON <OUTPUT>] [SUITE...]
+//
+// WITH NO SUITES NAMED, EVERY SUITE RUNS. THE JSON HOLDS ONE FLAT ENTRY PER RUN, KEYED BY SUITE AND NAME,
+// SO THAT TWO RELEASES CAN BE COMPARED LINE BY LINE
+
+// NESTED INCLUDES
+
+#include "bench.hh"
+#include <noodle/memory.hh>
+
+// SYSTEM INCLUDES
+
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+    struct SUITE
+    {
+        const char* NAME;
+        void (*FUNC)();
+    };
+
+    static const SUITE SUITES[] =
+    {
+        { "bus", noodle::bench::BENCH_BUS },
+        { "tlb", noodle::bench::BENCH_TLB },
+        { "mmu", noodle::bench::BENCH_MMU },
+        { "sync", noodle::bench::BENCH_SYNC },
+        { "endian", noodle::bench::BENCH_ENDIAN },
+        { "log", noodle::bench::BENCH_LOG }
+    };
+
+    // RUN NAMES ARE OUR OWN LITERALS, BUT ESCAPE ANYTHING JSON WOULD OBJECT TO REGARDLESS
+    static std::string ESCAPE(const std::string& TEXT)
+    {
+        std::string OUTPUT;
+
+        for(const char CHAR : TEXT)
+        {
+            if(CHAR == '"' || CHAR == '\\') OUTPUT += '\\';
+            OUTPUT += CHAR;
+        }
+
+        return OUTPUT;
+    }
+
+    static bool WRITE_JSON(const char* PATH, bool PERF)
+    {
+        std::FILE* OUTPUT = std::fopen(PATH, "w");
+        if(OUTPUT == nullptr) return false;
+
+        #if defined(__clang__)
+            const char* COMPILER = "clang " __clang_version__;
+        #elif defined(__GNUC__)
+            const char* COMPILER = "gcc " __VERSION__;
+        #else
+            const char* COMPILER = "unknown";
+        #endif
+
+        fmt::print(OUTPUT, "{{\n  \"compiler\": \"{}\",\n  \"profile\": {},\n  \"perf\": {},\n  \"results\": [\n",
+                   ESCAPE(COMPILER), NOODLE_BUS_PROFILE ? "true" : "false", PERF ? "true" : "false");
+
+        const std::vector<noodle::bench::BENCH_RECORD>& LIST = noodle::bench::RECORDS();
+
+        for(std::size_t INDEX = 0; INDEX < LIST.size(); INDEX++)
+        {
+            const noodle::bench::BENCH_RECORD& RECORD = LIST[INDEX];
+
+            fmt::print(OUTPUT, "    {{ \"suite\": \"{}\", \"name\": \"{}\", \"ops\": {}, \"ns_per_op\": {:.4f}, \"ticks_per_op\": {:.4f}",
+                       ESCAPE(RECORD.SUITE), ESCAPE(RECORD.NAME), RECORD.OPS, RECORD.NS, RECORD.TICKS);
+
+            if(RECORD.HAS_COUNTERS)
+            {
+                for(U32 COUNTER = 0; COUNTER < noodle::bench::PERF_COUNT; COUNTER++)
+                    fmt::print(OUTPUT, ", \"{}_per_op\": {:.4f}", noodle::bench::PERF_NAMES[COUNTER], RECORD.COUNTERS[COUNTER]);
+            }
+
+            fmt::print(OUTPUT, " }}{}\n", INDEX + 1 < LIST.size() ? "," : "");
+        }
+
+        fmt::print(OUTPUT, "  ]\n}}\n");
+        return std::fclose(OUTPUT) == 0;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const char* JSON = nullptr;
+    bool PERF = false;
+    std::vector<const char*> SELECTED;
+
+    for(int INDEX = 1; INDEX < argc; INDEX++)
+    {
+        if(std::strcmp(argv[INDEX], "--json") == 0 && INDEX + 1 < argc)
+        {
+            JSON = argv[++INDEX];
+            continue;
+        }
+
+        if(std::strcmp(argv[INDEX], "--perf") == 0)
+        {
+            PERF = true;
+            continue;
+        }
+
+        bool KNOWN = false;
+
+        for(const SUITE& ENTRY : SUITES)
+            KNOWN |= std::strcmp(argv[INDEX], ENTRY.NAME) == 0;
+
+        if(!KNOWN)
+        {
+            fmt::print(stderr, "USAGE: {} [--perf] [--json <OUTPUT>] [bus|tlb|mmu|sync|endian|log...]\n", argv[0]);
+            return 2;
+        }
+
+        SELECTED.push_back(argv[INDEX]);
+    }
+
+    fmt::print("NOODLE - BENCHMARKS\n\n");
+
+    if(PERF && !noodle::bench::PERF_OPEN())
+    {
+        fmt::print("HARDWARE COUNTERS UNAVAILABLE (PERF_EVENT_OPEN FAILED) - REPORTING TIME AND TICKS ONLY\n\n");
+        PERF = false;
+    }
+
+    for(const SUITE& ENTRY : SUITES)
+    {
+        bool RUN = SELECTED.empty();
+
+        for(const char* NAME : SELECTED)
+            RUN |= std::strcmp(NAME, ENTRY.NAME) == 0;
+
+        if(!RUN) continue;
+
+        noodle::bench::CURRENT_SUITE() = ENTRY.NAME;
+        ENTRY.FUNC();
+    }
+
+    noodle::bench::PERF_CLOSE();
+
+    if(JSON != nullptr)
+    {
+        if(!WRITE_JSON(JSON, PERF))
+        {
+            fmt::print(stderr, "COULD NOT WRITE {}\n", JSON);
+            return 1;
+        }
+
+        fmt::print("WROTE {} RESULTS TO {}\n", noodle::bench::RECORDS().size(), JSON);
+    }
+
+    return 0;
+}
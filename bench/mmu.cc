@@ -0,0 +1,64 @@
+// COPYRIGHT (C) HARRY CLARK 2025
+// A LIGHTWEIGHT IMPLEMENTATION OF COMMON UTILITIES
+
+// 68851 TRANSLATION BENCHMARKS - ATC HIT PATH AND TRANSLATED ACCESSES
+
+// NESTED INCLUDES
+
+#include "bench.hh"
+#include <noodle/memory.hh>
+#include <noodle/mmu.hh>
+
+using namespace fujiko::memory;
+
+void noodle::bench::BENCH_MMU()
+{
+    static constexpr U64 OPS = 1U << 24;
+    static constexpr U32 TABLE_A = 0x2000;
+    static constexpr U32 TABLE_B = 0x4000;
+
+    using MMU = MMU_68851<MEMORY_BUS>;
+
+    MEMORY_BUS BUS;
+    BUS.MAP_ARRAY(0x00000000, 0x0000FFFF, MEMORY_ARRAY, true).REPORT();
+
+    // IDENTITY MAP THE FIRST 64KB OF LOGICAL SPACE WITH 4KB PAGES
+    BUS.WRITE<U32>(TABLE_A, TABLE_B | MMU::DT_SHORT);
+
+    for(U32 PAGE = 0; PAGE < 16; PAGE++)
+        BUS.WRITE<U32>(TABLE_B + (PAGE * 4), (PAGE << 12) | MMU::DESC_M | MMU::DT_PAGE);
+
+    MMU TRANSLATOR(BUS);
+    TRANSLATOR.SET_CRP(MMU::DT_SHORT, TABLE_A);
+    TRANSLATOR.SET_TC(0x80C0AA00);
+
+    RUN("MMU TRANSLATE (ATC MRU HIT)", OPS, [&](U64 INDEX)
+    {
+        DO_NOT_OPTIMISE(TRANSLATOR.TRANSLATE(0x8000 + (static_cast<U32>(INDEX << 2) & 0xFFC), fc::USER_DATA, false));
+    });
+
+    RUN("MMU TRANSLATE (ATC SCAN HIT)", OPS, [&](U64 INDEX)
+    {
+        DO_NOT_OPTIMISE(TRANSLATOR.TRANSLATE((static_cast<U32>(INDEX << 12) & 0xF000), fc::USER_DATA, false));
+    });
+
+    RUN("MMU READ<U32> (ATC MRU HIT)", OPS, [&](U64 INDEX)
+    {
+        U32 VALUE = 0;
+        DO_NOT_OPTIMISE(TRANSLATOR.READ<U32>(0x8000 + (static_cast<U32>(INDEX << 2) & 0xFFC), fc::USER_DATA, VALUE));
+        DO_NOT_OPTIMISE(VALUE);
+    });
+
+    RUN("MMU TRY_READ<U32> (ATC MRU HIT)", OPS, [&](U64 INDEX)
+    {
+        DO_NOT_OPTIMISE(TRANSLATOR.TRY_READ<U32>(0x8000 + (static_cast<U32>(INDEX << 2) & 0xFFC), fc::USER_DATA).VALUE());
+    });
+
+    RUN("MMU TABLE WALK (FLUSHED)", OPS / 16, [&](U64 INDEX)
+    {
+        TRANSLATOR.FLUSH();
+        DO_NOT_OPTIMISE(TRANSLATOR.TRANSLATE(0x8000, fc::USER_DATA, false));
+    });
+
+    fmt::print("\n");
+}
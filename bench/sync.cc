@@ -0,0 +1,92 @@
+// COPYRIGHT (C) HARRY CLARK 2025
+// A LIGHTWEIGHT IMPLEMENTATION OF COMMON UTILITIES
+
+// SHARED BUS BENCHMARKS - READER COST AND SCALING ACROSS THREADS, AND THE COST OF A PUBLISHED REMAP
+
+// NESTED INCLUDES
+
+#include "bench.hh"
+#include <noodle/memory.hh>
+
+// SYSTEM INCLUDES
+
+#include <algorithm>
+#include <array>
+#include <thread>
+#include <vector>
+
+using namespace fujiko::memory;
+
+using WIDE_SHARED_BUS = BASIC_MEMORY_BUS<32, 12, FUJIKO_ENDIAN_NATIVE, FUJIKO_SYNC_SHARED>;
+
+void noodle::bench::BENCH_SYNC()
+{
+    static constexpr U64 OPS = 1U << 24;
+    static constexpr U64 REMAP_OPS = 1U << 12;
+
+    MEMORY_BUS LOCAL;
+    SHARED_MEMORY_BUS BUS;
+
+    LOCAL.MAP_BUFFER(0x00000000, 0x0000FFFF, MEMORY_ARRAY.data(), MEMORY_ARRAY.size()).REPORT();
+    BUS.MAP_BUFFER(0x00000000, 0x0000FFFF, MEMORY_ARRAY.data(), MEMORY_ARRAY.size()).REPORT();
+
+    const double LOCAL_NS = RUN("BUS READ<U32> RAM (UNSHARED)", OPS, [&](U64 INDEX)
+    {
+        DO_NOT_OPTIMISE(LOCAL.READ<U32>(static_cast<U32>(INDEX << 2) & 0xFFFC));
+    });
+
+    const double SHARED_NS = RUN("BUS READ<U32> RAM (SHARED)", OPS, [&](U64 INDEX)
+    {
+        DO_NOT_OPTIMISE(BUS.READ<U32>(static_cast<U32>(INDEX << 2) & 0xFFFC));
+    });
+
+    fmt::print("SHARED READ OVERHEAD: {:+.3f} NS/OP\n", SHARED_NS - LOCAL_NS);
+
+    // AGGREGATE READ THROUGHPUT WITH EVERY READER ON IT'S OWN THREAD, NO REMAPS
+    // THIS CAN ONLY SCALE AS FAR AS THE HOST HAS CORES
+    const U32 CORES = std::max(1U, std::thread::hardware_concurrency());
+
+    for(U32 THREADS = 1; THREADS <= std::min(CORES, 8U); THREADS *= 2)
+    {
+        std::vector<std::thread> POOL;
+        const auto START = std::chrono::steady_clock::now();
+
+        for(U32 INDEX = 0; INDEX < THREADS; INDEX++)
+        {
+            POOL.emplace_back([&BUS]()
+            {
+                const U32 SLOT = BUS.PAGES.REGISTER_READER();
+
+                for(U64 OP = 0; OP < OPS; OP++)
+                {
+                    DO_NOT_OPTIMISE(BUS.READ<U32>(static_cast<U32>(OP << 2) & 0xFFFC));
+                    if((OP & 0xFFFF) == 0) BUS.PAGES.QUIESCENT(SLOT);
+                }
+
+                BUS.PAGES.UNREGISTER_READER(SLOT);
+            });
+        }
+
+        for(std::thread& THREAD : POOL) THREAD.join();
+
+        const double SECONDS = std::chrono::duration<double>(std::chrono::steady_clock::now() - START).count();
+        fmt::print("{:<40} {:>10.1f} MOPS/S\n", fmt::format("SHARED READ<U32> x{} THREADS", THREADS),
+                   (static_cast<double>(OPS) * THREADS) / SECONDS / 1e6);
+    }
+
+    // A REMAP IS A COPY OF THE TABLE (OR THE TOUCHED LEAVES) AND A POINTER SWAP
+    // EACH ITERATION FLIPS THE RANGE BETWEEN TWO BUFFERS, SO EVERY EDIT REALLY DOES PUBLISH
+    alignas(64) static std::array<U8, 0x10000> OTHER;
+    auto WIDE = std::make_unique<WIDE_SHARED_BUS>();
+
+    const auto FLIP = [&](auto& TARGET, U64 INDEX)
+    {
+        TARGET.MAP_BUFFER(0x00000000, 0x0000FFFF, (INDEX & 1) ? OTHER.data() : MEMORY_ARRAY.data(), 0x10000).REPORT();
+    };
+
+    RUN("MAP_BUFFER 64KB (UNSHARED)", REMAP_OPS, [&](U64 INDEX) { FLIP(LOCAL, INDEX); });
+    RUN("MAP_BUFFER 64KB (SHARED, 16KB TABLE)", REMAP_OPS, [&](U64 INDEX) { FLIP(BUS, INDEX); });
+    RUN("MAP_BUFFER 64KB (SHARED, 32/12 TABLE)", REMAP_OPS, [&](U64 INDEX) { FLIP(*WIDE, INDEX); });
+
+    fmt::print("\n");
+}
@@ -0,0 +1,83 @@
+// COPYRIGHT (C) HARRY CLARK 2025
+// A LIGHTWEIGHT IMPLEMENTATION OF COMMON UTILITIES
+
+// SOFTWARE TLB BENCHMARKS - PLAIN PAGE LOOKUP VERSUS THE TLB ACROSS A HANDFUL OF ACCESS TRACES
+
+// NESTED INCLUDES
+
+#include "bench.hh"
+#include <noodle/memory.hh>
+#include <noodle/tlb.hh>
+
+// SYSTEM INCLUDES
+
+#include <random>
+#include <vector>
+
+using namespace fujiko::memory;
+
+namespace
+{
+    static U32 DEVICE_READ_32(U32 ADDRESS, void* CTX) { return ADDRESS; }
+    static void DEVICE_WRITE_32(U32 ADDRESS, U32 VALUE, void* CTX) {}
+
+    // RUN A SINGLE TRACE THROUGH BOTH THE BUS AND THE TLB
+    template<typename BUS_TYPE>
+    static void RUN_TRACE(const char* NAME, BUS_TYPE& BUS, const std::vector<U32>& TRACE)
+    {
+        static constexpr U64 OPS = 1U << 24;
+        const U64 MASK = TRACE.size() - 1;
+
+        MEMORY_TLB<BUS_TYPE> TLB(BUS);
+
+        noodle::bench::RUN(fmt::format("BUS READ<U32> {}", NAME).c_str(), OPS, [&](U64 INDEX)
+        {
+            noodle::bench::DO_NOT_OPTIMISE(BUS.template READ<U32>(TRACE[INDEX & MASK]));
+        });
+
+        noodle::bench::RUN(fmt::format("TLB READ<U32> {}", NAME).c_str(), OPS, [&](U64 INDEX)
+        {
+            noodle::bench::DO_NOT_OPTIMISE(TLB.template READ<U32>(TRACE[INDEX & MASK]));
+        });
+
+        // HITS ARE ONLY COUNTED WITH NOODLE_TLB_STATS, BUT EVERY ACCESS WHICH ISN'T A MISS IS ONE -
+        // RUN MAKES A WARM UP PASS OF OPS / 16 BEFORE THE TIMED OPS
+        const double ACCESSES = static_cast<double>(OPS + OPS / 16);
+        fmt::print("TLB HIT RATE: {:.2f}%\n", 100.0 * (ACCESSES - static_cast<double>(TLB.MISSES)) / ACCESSES);
+    }
+}
+
+void noodle::bench::BENCH_TLB()
+{
+    static constexpr U32 TRACE_SIZE = 1U << 16;
+    static constexpr U32 MMIO_BASE = 0x01000000;
+
+    MEMORY_BUS BUS;
+    BUS.MAP_ARRAY(0x00000000, 0x007FFFFF, MEMORY_ARRAY, true).REPORT();
+    BUS.MAP_HANDLER(MMIO_BASE, MMIO_BASE + 0xFFFF, nullptr, FUJIKO_HANDLER<U32>{ DEVICE_READ_32, DEVICE_WRITE_32 }).REPORT();
+
+    std::mt19937 RNG(0x6E6F6F64);
+    std::vector<U32> SEQUENTIAL(TRACE_SIZE), STRIDED(TRACE_SIZE), RANDOM(TRACE_SIZE), MIXED(TRACE_SIZE);
+
+    for(U32 INDEX = 0; INDEX < TRACE_SIZE; INDEX++)
+    {
+        SEQUENTIAL[INDEX] = INDEX << 2;
+        // ONE PAGE AND A WORD ON PER ACCESS - EVERY ACCESS CHANGES PAGE, ACROSS ALL 128 PAGES OF THE RANGE
+        STRIDED[INDEX] = (INDEX * 0x10004) & 0x007FFFFC;
+        RANDOM[INDEX] = RNG() & 0x007FFFFC;
+        MIXED[INDEX] = (INDEX & 7) == 0 ? MMIO_BASE + ((INDEX << 2) & 0xFFFC) : (INDEX << 2);
+    }
+
+    RUN_TRACE("SEQUENTIAL", BUS, SEQUENTIAL);
+    RUN_TRACE("STRIDED (64KB + 4)", BUS, STRIDED);
+    RUN_TRACE("RANDOM", BUS, RANDOM);
+    RUN_TRACE("MMIO MIXED (1 IN 8)", BUS, MIXED);
+
+    // THE SAME SEQUENTIAL WALK OVER A TWO-LEVEL 32-BIT TABLE WITH 4KB PAGES
+    auto WIDE = std::make_unique<BASIC_MEMORY_BUS<32, 12>>();
+    WIDE->MAP_ARRAY(0x00000000, 0x007FFFFF, MEMORY_ARRAY, true).REPORT();
+
+    RUN_TRACE("SEQUENTIAL (32-BIT, 4KB PAGES)", *WIDE, SEQUENTIAL);
+
+    fmt::print("\n");
+}
@@ -1,36 +1,52 @@
-/* COPYRIHGT (C) HARRY CLARK 2025 */
-/* HARRY CLARK'S COMMON UTILITY LIBRARY */
-
-/* THIS FILE IS ABOUT COMMON DATA TYPES USED THROUGHOUT THE PROJECT */
-/* CREATING TYPE DEFINED METHODS TO INSTANTIATE RAW POINTERS FOR MY */
-/* METHODS, FUNCTIONS, ETC */
-
-/* THANK YOU TO INTNS FOR THE TEMPLATES - THIS MAKES TYPES MUCH EASIER TO INCLUDE IN C++ PROJECTS */
-
-#pragma once
-
-// SYSTEM INCLUDES
-
-#include <cstdint>
-#include <cmath>
-#include <limits>
-#include <type_traits>
-
-using S8 = std::int8_t;
-using S16 = std::int16_t;
-using S32 = std::int32_t;
-using S64 = std::int64_t;
-
-using U8 = std::uint8_t;
-using U16 = std::uint16_t;
-using U32 = std::uint32_t;
-using U64 = std::uint64_t;
-
-using VU8 = volatile U8;
-using VU16 = volatile U16;
-using VU32 = volatile U32;
-using VU64 = volatile U64;
-using VS8 = volatile S8;
-using VS16 = volatile S16;
-using VS32 = volatile S32;
-using VS64 = volatile S64;
\ No newline at end of file
+/* COPYRIHGT (C) HARRY CLARK 2025 */
+/* HARRY CLARK'S COMMON UTILITY LIBRARY */
+
+/* THIS FILE IS ABOUT COMMON DATA TYPES USED THROUGHOUT THE PROJECT */
+/* CREATING TYPE DEFINED METHODS TO INSTANTIATE RAW POINTERS FOR MY */
+/* METHODS, FUNCTIONS, ETC */
+
+/* THANK YOU TO INTNS FOR THE TEMPLATES - THIS MAKES TYPES MUCH EASIER TO INCLUDE IN C++ PROJECTS */
+
+#pragma once
+
+// SYSTEM INCLUDES
+
+#include <cstdint>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+using S8 = std::int8_t;
+using S16 = std::int16_t;
+using S32 = std::int32_t;
+using S64 = std::int64_t;
+
+using U8 = std::uint8_t;
+using U16 = std::uint16_t;
+using U32 = std::uint32_t;
+using U64 = std::uint64_t;
+
+using VU8 = volatile U8;
+using VU16 = volatile U16;
+using VU32 = volatile U32;
+using VU64 = volatile U64;
+using VS8 = volatile S8;
+using VS16 = volatile S16;
+using VS32 = volatile S32;
+using VS64 = volatile S64;
+
+// COMPILER HINTS FOR HOT PATHS
+// THESE ALLOW FOR THE FAST PATH OF A GIVEN ROUTINE TO BE INLINED INTO IT'S CALLER
+// WHILST THE COLD FALLBACK IS KEPT OUT OF LINE
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define NOODLE_FORCE_INLINE inline __attribute__((always_inline))
+    #define NOODLE_NO_INLINE __attribute__((noinline))
+    #define NOODLE_LIKELY(EXPR) __builtin_expect(!!(EXPR), 1)
+    #define NOODLE_UNLIKELY(EXPR) __builtin_expect(!!(EXPR), 0)
+#else
+    #define NOODLE_FORCE_INLINE inline
+    #define NOODLE_NO_INLINE
+    #define NOODLE_LIKELY(EXPR) (EXPR)
+    #define NOODLE_UNLIKELY(EXPR) (EXPR)
+#endif
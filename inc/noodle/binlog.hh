@@ -0,0 +1,638 @@
+// COPYRIGHT (C) HARRY CLARK 2025
+// A LIGHTWEIGHT IMPLEMENTATION OF COMMON UTILITIES
+
+// THIS FILE PERTAINS TOWARDS A BINARY, DEFERRED-FORMAT LOG FOR THE ERROR HANDLING SCHEME
+// FORMATTING TEXT IS WHAT A MESSAGE COSTS THE CALLER, SO IN THIS MODE NOTHING IS FORMATTED AT ALL -
+// EACH CALL SITE IS GIVEN AN ID BEFORE MAIN RUNS, AND A MESSAGE IS JUST THAT ID, A TIMESTAMP AND THE RAW BYTES
+// OF IT'S ARGUMENTS, COPIED INTO A MEMORY MAPPED FILE. DECODE_LOG (AND THE NOODLE_LOGDUMP TOOL)
+// RENDERS THE FILE TO TEXT AFTERWARDS
+//
+// THE FILE IS LAID OUT AS A FIXED HEADER, THE TABLE OF CALL SITES, THEN THE RECORDS:
+//
+//      U32 SITE, U32 LENGTH, U64 TICKS, THEN LENGTH BYTES OF ARGUMENTS
+//
+// WHERE EACH ARGUMENT IS IT'S VALUE IN HOST ORDER, OR A U16 LENGTH FOLLOWED BY THE BYTES FOR A STRING.
+// THE FILE IS WRITTEN AND READ IN HOST ORDER, AS IT IS MEANT TO BE DECODED ON THE MACHINE WHICH WROTE IT
+
+#ifndef BINLOG_HH
+#define BINLOG_HH
+
+// NESTED INCLUDES
+#include <common.hh>
+#include <noodle/error.hh>
+#include <fmt/args.h>
+
+// SYSTEM INCLUDES
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+#endif
+
+    // LOG A MESSAGE TO THE BINARY LOG WHEN IT IS OPEN, OTHERWISE AS TEXT THROUGH NOODLE_PRINT
+    // THE LOCAL CLASS GIVES THE CALL SITE IT'S IDENTITY - EVERYTHING IT DESCRIBES IS KNOWN AT COMPILE TIME
+    // THE LOG IS CHECKED BEFORE EITHER BRANCH SO THAT THE ARGUMENTS ARE ONLY EVER EVALUATED ONCE
+    #define NOODLE_BINARY_PRINT(CAT_VALUE, SEV_VALUE, FMT_STR, ...) \
+    do \
+    { \
+        struct NOODLE_LOG_SITE \
+        { \
+            static constexpr const char* FORMAT() { return FMT_STR; } \
+            static constexpr const char* SOURCE_FILE() { return __FILE__; } \
+            static constexpr U32 LINE() { return __LINE__; } \
+            static constexpr noodle::err::ERROR_CATEGORY CAT() { return CAT_VALUE; } \
+            static constexpr noodle::err::ERROR_SEVERITY SEV() { return SEV_VALUE; } \
+        }; \
+        \
+        if(noodle::err::BINARY_LOG::INSTANCE().ACTIVE()) \
+        { \
+            noodle::err::ERROR_METRICS::INSTANCE().RECORD(CAT_VALUE, SEV_VALUE); \
+            noodle::err::BINARY_LOG::INSTANCE().WRITE<NOODLE_LOG_SITE>(__VA_ARGS__); \
+        } \
+        else \
+            noodle::err::NOODLE_PRINT(CAT_VALUE, SEV_VALUE, FMT_STRING(FMT_STR), ##__VA_ARGS__); \
+    } while(0)
+
+namespace noodle
+{
+    namespace err
+    {
+        // HOW EACH ARGUMENT IS HELD IN A RECORD - THE KIND IN THE HIGH NIBBLE, THE SIZE IN BYTES IN THE LOW
+        enum class LOG_ARG : U8
+        {
+            END = 0x00,
+            BOOL = 0x10,
+            CHAR = 0x20,
+            SIGNED = 0x30,
+            UNSIGNED = 0x40,
+            FLOAT = 0x50,
+            POINTER = 0x60,
+            STRING = 0x70
+        };
+
+        // WHAT IS KNOWN ABOUT A CALL SITE WITHOUT RUNNING IT
+        // ARGS IS A LIST OF LOG_ARG CODES, TERMINATED BY END
+        struct LOG_SITE
+        {
+            const char* FORMAT;
+            const char* FILE;
+            U32 LINE;
+            ERROR_CATEGORY CAT;
+            ERROR_SEVERITY SEV;
+            const U8* ARGS;
+        };
+
+        // EVERY CALL SITE IN THE PROGRAM, REGISTERED DURING STATIC INITIALISATION - IDS START FROM ONE
+        inline std::vector<LOG_SITE>& LOG_SITES()
+        {
+            static std::vector<LOG_SITE> SITES;
+            return SITES;
+        }
+
+        inline U32 REGISTER_SITE(const LOG_SITE& SITE)
+        {
+            LOG_SITES().push_back(SITE);
+            return static_cast<U32>(LOG_SITES().size());
+        }
+
+        // THE FORM AN ARGUMENT IS STORED IN
+        // STRINGS OF ANY KIND BECOME A STRING_VIEW, ENUMS THEIR UNDERLYING TYPE AND ANY OTHER POINTER A CONST VOID*
+        template<typename T, typename = void>
+        struct LOG_STORED
+        {
+            using TYPE = std::conditional_t<std::is_pointer<T>::value, const void*, T>;
+        };
+
+        template<typename T>
+        struct LOG_STORED<T, std::enable_if_t<std::is_enum<T>::value>> { using TYPE = std::underlying_type_t<T>; };
+
+        template<> struct LOG_STORED<char*> { using TYPE = std::string_view; };
+        template<> struct LOG_STORED<const char*> { using TYPE = std::string_view; };
+        template<> struct LOG_STORED<std::string> { using TYPE = std::string_view; };
+        template<> struct LOG_STORED<std::string_view> { using TYPE = std::string_view; };
+
+        template<typename T>
+        using LOG_STORED_T = typename LOG_STORED<std::decay_t<T>>::TYPE;
+
+        template<typename T>
+        static constexpr U8 LOG_ARG_CODE()
+        {
+            if constexpr (std::is_same<T, std::string_view>::value) return static_cast<U8>(LOG_ARG::STRING);
+            else
+            {
+                static_assert(std::is_arithmetic<T>::value || std::is_pointer<T>::value,
+                              "BINARY LOG ARGUMENTS MUST BE ARITHMETIC, POINTERS, ENUMS OR STRINGS");
+
+                constexpr U8 SIZE = static_cast<U8>(sizeof(T));
+
+                if constexpr (std::is_same<T, bool>::value) return static_cast<U8>(LOG_ARG::BOOL) | SIZE;
+                else if constexpr (std::is_same<T, char>::value) return static_cast<U8>(LOG_ARG::CHAR) | SIZE;
+                else if constexpr (std::is_floating_point<T>::value) return static_cast<U8>(LOG_ARG::FLOAT) | SIZE;
+                else if constexpr (std::is_pointer<T>::value) return static_cast<U8>(LOG_ARG::POINTER) | SIZE;
+                else if constexpr (std::is_signed<T>::value) return static_cast<U8>(LOG_ARG::SIGNED) | SIZE;
+                else return static_cast<U8>(LOG_ARG::UNSIGNED) | SIZE;
+            }
+        }
+
+        template<typename... STORED>
+        static constexpr U8 LOG_ARG_CODES[] = { LOG_ARG_CODE<STORED>()..., static_cast<U8>(LOG_ARG::END) };
+
+        // ONE ID PER CALL SITE AND ARGUMENT LIST, ASSIGNED WHEN THE PROGRAM STARTS
+        // SITE IS A LOCAL CLASS DECLARED BY THE MACRO AT THE CALL SITE, SO EVERY SITE INSTANTIATES IT'S OWN
+        template<typename SITE, typename... STORED>
+        inline const U32 LOG_SITE_ID = REGISTER_SITE(LOG_SITE{ SITE::FORMAT(), SITE::SOURCE_FILE(), SITE::LINE(),
+                                                               SITE::CAT(), SITE::SEV(), LOG_ARG_CODES<STORED...> });
+
+        // THE FIXED HEADER AT THE START OF EVERY BINARY LOG
+        struct BINARY_LOG_HEADER
+        {
+            char MAGIC[4];
+            U32 VERSION;
+            U32 SITE_COUNT;
+            U32 RECORD_HEADER;
+            U64 SITES_OFFSET;
+            U64 RECORDS_OFFSET;
+            U64 RECORDS_END;
+            U64 CAPACITY;
+            U64 TICKS_START;
+            U64 NS_START;
+            U64 TICKS_END;
+            U64 NS_END;
+            U64 DROPPED;
+        };
+
+        static constexpr U32 BINARY_LOG_VERSION = 1;
+        static constexpr std::size_t BINARY_RECORD_HEADER = 16;
+
+        // THE LOG ITSELF - A SINGLE FILE, OPENED ONCE FOR THE WHOLE PROGRAM
+        // PRODUCERS RESERVE THEIR RECORD WITH ONE ATOMIC ADD AND COPY STRAIGHT INTO THE MAPPING, SO THERE IS NO LOCK,
+        // NO SYSTEM CALL AND NO FORMATTING ON THE CALLING THREAD. ONCE THE FILE IS FULL, FURTHER MESSAGES ARE DROPPED
+        // AND COUNTED. AS WITH THE ASYNCHRONOUS LOG, PRODUCERS ARE COUNTED IN AND OUT, SO CLOSE WAITS FOR ANY STILL WRITING
+        class BINARY_LOG
+        {
+            public:
+                static BINARY_LOG& INSTANCE()
+                {
+                    static BINARY_LOG LOG;
+                    return LOG;
+                }
+
+                ~BINARY_LOG() { CLOSE(); }
+
+                static NOODLE_FORCE_INLINE U64 TICKS()
+                {
+                    #if defined(__x86_64__) || defined(__i386__)
+                        return __rdtsc();
+                    #else
+                        return static_cast<U64>(std::chrono::steady_clock::now().time_since_epoch().count());
+                    #endif
+                }
+
+                static U64 NOW_NS()
+                {
+                    return static_cast<U64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now().time_since_epoch()).count());
+                }
+
+                bool OPEN(const char* PATH, std::size_t CAPACITY = std::size_t{64} << 20)
+                {
+                    #if defined(__unix__) || defined(__APPLE__)
+                        if(ACTIVE()) return false;
+
+                        // THE SITE TABLE IS COMPLETE BY NOW, SO IT IS WRITTEN OUT AHEAD OF THE RECORDS
+                        std::vector<U8> SITES;
+                        for(const LOG_SITE& SITE : LOG_SITES())
+                        {
+                            U8 HEAD[8] = { static_cast<U8>(SITE.CAT), static_cast<U8>(SITE.SEV), 0, 0 };
+                            std::memcpy(HEAD + 4, &SITE.LINE, 4);
+
+                            SITES.insert(SITES.end(), HEAD, HEAD + sizeof(HEAD));
+                            APPEND_STRING(SITES, SITE.FORMAT);
+                            APPEND_STRING(SITES, SITE.FILE);
+                            APPEND_STRING(SITES, reinterpret_cast<const char*>(SITE.ARGS));
+                        }
+
+                        const U64 RECORDS_OFFSET = (sizeof(BINARY_LOG_HEADER) + SITES.size() + 63) & ~U64{63};
+                        const int FD = ::open(PATH, O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+                        if(FD < 0 || ::ftruncate(FD, static_cast<off_t>(RECORDS_OFFSET + CAPACITY)) != 0)
+                        {
+                            NOODLE_SYSTEM_ERROR("BINARY_LOG: COULD NOT CREATE {} ({})", PATH, std::strerror(errno));
+                            if(FD >= 0) ::close(FD);
+                            return false;
+                        }
+
+                        void* MAPPED = ::mmap(nullptr, RECORDS_OFFSET + CAPACITY, PROT_READ | PROT_WRITE, MAP_SHARED, FD, 0);
+
+                        if(MAPPED == MAP_FAILED)
+                        {
+                            NOODLE_SYSTEM_ERROR("BINARY_LOG: COULD NOT MAP {} ({})", PATH, std::strerror(errno));
+                            ::close(FD);
+                            return false;
+                        }
+
+                        BASE = static_cast<U8*>(MAPPED);
+                        RECORDS = BASE + RECORDS_OFFSET;
+                        this->CAPACITY = CAPACITY;
+                        this->FD = FD;
+
+                        BINARY_LOG_HEADER HEADER{};
+                        std::memcpy(HEADER.MAGIC, "NBLG", 4);
+                        HEADER.VERSION = BINARY_LOG_VERSION;
+                        HEADER.SITE_COUNT = static_cast<U32>(LOG_SITES().size());
+                        HEADER.RECORD_HEADER = BINARY_RECORD_HEADER;
+                        HEADER.SITES_OFFSET = sizeof(BINARY_LOG_HEADER);
+                        HEADER.RECORDS_OFFSET = RECORDS_OFFSET;
+                        HEADER.CAPACITY = CAPACITY;
+                        HEADER.TICKS_START = TICKS();
+                        HEADER.NS_START = NOW_NS();
+
+                        std::memcpy(BASE, &HEADER, sizeof(HEADER));
+                        std::memcpy(BASE + sizeof(HEADER), SITES.data(), SITES.size());
+
+                        END.store(0, std::memory_order_relaxed);
+                        DROPS.store(0, std::memory_order_relaxed);
+                        RUNNING.store(true, std::memory_order_release);
+                        return true;
+                    #else
+                        NOODLE_UNIMPL_ERROR("BINARY_LOG: MEMORY MAPPED FILES ARE NOT SUPPORTED ON THIS PLATFORM ({})", PATH);
+                        return false;
+                    #endif
+                }
+
+                // SEAL THE HEADER AND TRIM THE FILE DOWN TO WHAT WAS WRITTEN
+                // ONCE NO NEW PRODUCER CAN GET IN, THE FILE IS ONLY UNMAPPED AFTER THE LAST ONE STILL WRITING HAS LEFT
+                void CLOSE()
+                {
+                    #if defined(__unix__) || defined(__APPLE__)
+                        if(!RUNNING.exchange(false))
+                            return;
+
+                        while(PRODUCERS.load() != 0)
+                            std::this_thread::yield();
+
+                        BINARY_LOG_HEADER HEADER;
+                        std::memcpy(&HEADER, BASE, sizeof(HEADER));
+
+                        HEADER.RECORDS_END = std::min<U64>(END.load(std::memory_order_acquire), CAPACITY);
+                        HEADER.TICKS_END = TICKS();
+                        HEADER.NS_END = NOW_NS();
+                        HEADER.DROPPED = DROPS.load(std::memory_order_relaxed);
+                        std::memcpy(BASE, &HEADER, sizeof(HEADER));
+
+                        ::munmap(BASE, HEADER.RECORDS_OFFSET + CAPACITY);
+                        (void)::ftruncate(FD, static_cast<off_t>(HEADER.RECORDS_OFFSET + HEADER.RECORDS_END));
+                        ::close(FD);
+
+                        BASE = RECORDS = nullptr;
+                    #endif
+                }
+
+                bool ACTIVE() const { return RUNNING.load(std::memory_order_relaxed); }
+                U64 DROPPED() const { return DROPS.load(std::memory_order_relaxed); }
+
+                // RECORD A MESSAGE FROM THE GIVEN SITE, ONCE THE CALLER HAS SEEN THE LOG ACTIVE
+                // COUNTED IN BEFORE CHECKING AGAIN, AS CLOSE CLEARS THAT BEFORE COUNTING US - A MESSAGE WHICH LOSES
+                // THE RACE HAS ALREADY PASSED THE TEXT FALLBACK, SO IS DROPPED AND COUNTED, RETURNING FALSE
+                template<typename SITE, typename... ARGS>
+                NOODLE_FORCE_INLINE bool WRITE(const ARGS&... A)
+                {
+                    PRODUCERS.fetch_add(1);
+                    const bool WRITTEN = RUNNING.load();
+
+                    if(WRITTEN)
+                        RECORD<SITE>(A...);
+                    else
+                        DROPS.fetch_add(1, std::memory_order_relaxed);
+
+                    PRODUCERS.fetch_sub(1, std::memory_order_release);
+                    return WRITTEN;
+                }
+
+            private:
+                BINARY_LOG() = default;
+
+                // RESERVE AND FILL ONE RECORD, DROPPING ANY WHICH WOULD RUN PAST THE END OF THE FILE
+                template<typename SITE, typename... ARGS>
+                NOODLE_FORCE_INLINE void RECORD(const ARGS&... A)
+                {
+                    const U32 ID = LOG_SITE_ID<SITE, LOG_STORED_T<ARGS>...>;
+                    const U32 LENGTH = (static_cast<U32>(0) + ... + ARG_SIZE(STORE(A)));
+                    const U64 AT = END.fetch_add(BINARY_RECORD_HEADER + LENGTH, std::memory_order_relaxed);
+
+                    if(NOODLE_UNLIKELY(AT + BINARY_RECORD_HEADER + LENGTH > CAPACITY))
+                    {
+                        DROPS.fetch_add(1, std::memory_order_relaxed);
+                        return;
+                    }
+
+                    U8* OUT = RECORDS + AT;
+                    const U64 NOW = TICKS();
+
+                    std::memcpy(OUT, &ID, 4);
+                    std::memcpy(OUT + 4, &LENGTH, 4);
+                    std::memcpy(OUT + 8, &NOW, 8);
+                    OUT += BINARY_RECORD_HEADER;
+
+                    (PACK(OUT, STORE(A)), ...);
+                }
+
+                static void APPEND_STRING(std::vector<U8>& OUT, const char* TEXT)
+                {
+                    const std::size_t LENGTH = std::strlen(TEXT);
+                    OUT.push_back(static_cast<U8>(LENGTH));
+                    OUT.push_back(static_cast<U8>(LENGTH >> 8));
+                    OUT.insert(OUT.end(), TEXT, TEXT + LENGTH);
+                }
+
+                template<typename T>
+                static NOODLE_FORCE_INLINE LOG_STORED_T<T> STORE(const T& VALUE)
+                {
+                    if constexpr (std::is_array<T>::value)
+                        return std::string_view(VALUE);
+                    else if constexpr (std::is_same<T, char*>::value || std::is_same<T, const char*>::value)
+                        return VALUE ? std::string_view(VALUE) : std::string_view("(NULL)");
+                    else
+                        return static_cast<LOG_STORED_T<T>>(VALUE);
+                }
+
+                template<typename T>
+                static NOODLE_FORCE_INLINE U32 ARG_SIZE(const T& VALUE)
+                {
+                    if constexpr (std::is_same<T, std::string_view>::value)
+                        return 2 + static_cast<U32>(std::min<std::size_t>(VALUE.size(), 0xFFFF));
+                    else
+                        return sizeof(T);
+                }
+
+                template<typename T>
+                static NOODLE_FORCE_INLINE void PACK(U8*& OUT, const T& VALUE)
+                {
+                    if constexpr (std::is_same<T, std::string_view>::value)
+                    {
+                        const U16 LENGTH = static_cast<U16>(std::min<std::size_t>(VALUE.size(), 0xFFFF));
+                        std::memcpy(OUT, &LENGTH, 2);
+                        std::memcpy(OUT + 2, VALUE.data(), LENGTH);
+                        OUT += 2 + LENGTH;
+                    }
+                    else
+                    {
+                        std::memcpy(OUT, &VALUE, sizeof(T));
+                        OUT += sizeof(T);
+                    }
+                }
+
+                U8* BASE = nullptr;
+                U8* RECORDS = nullptr;
+                U64 CAPACITY = 0;
+                int FD = -1;
+
+                alignas(64) std::atomic<U64> END{0};
+                std::atomic<U64> DROPS{0};
+                std::atomic<bool> RUNNING{false};
+                alignas(64) std::atomic<U32> PRODUCERS{0};
+        };
+
+        // RENDER A BINARY LOG BACK TO TEXT, IN THE SAME LAYOUT AS NOODLE_PRINT WITH THE TIME AND SOURCE ADDED
+        // TIMES ARE MICROSECONDS SINCE THE LOG WAS OPENED, OR RAW TICKS WHEN THE LOG WAS NEVER CLOSED
+        //
+        // THE FILE IS UNTRUSTED - EVERY READ IS CHECKED AGAINST WHAT WAS ACTUALLY LOADED, AND A FILE WHICH FAILS
+        // ANY CHECK IS REJECTED FROM THAT POINT ON. A MESSAGE WHOSE FORMAT DOESN'T FIT IT'S ARGUMENTS IS WRITTEN AS A MARKER
+        inline bool DECODE_LOG(const char* PATH, std::FILE* OUTPUT)
+        {
+            std::FILE* INPUT = std::fopen(PATH, "rb");
+
+            if(INPUT == nullptr)
+            {
+                NOODLE_RESOURCE_ERROR("DECODE_LOG: CANNOT OPEN {}", PATH);
+                return false;
+            }
+
+            std::vector<U8> DATA;
+            U8 CHUNK[0x10000];
+
+            for(std::size_t READ; (READ = std::fread(CHUNK, 1, sizeof(CHUNK), INPUT)) > 0;)
+                DATA.insert(DATA.end(), CHUNK, CHUNK + READ);
+
+            std::fclose(INPUT);
+
+            BINARY_LOG_HEADER HEADER;
+
+            if(DATA.size() < sizeof(HEADER) || std::memcmp(DATA.data(), "NBLG", 4) != 0)
+            {
+                NOODLE_INVALID_ARG_ERROR("DECODE_LOG: {} IS NOT A BINARY LOG", PATH);
+                return false;
+            }
+
+            std::memcpy(&HEADER, DATA.data(), sizeof(HEADER));
+
+            if(HEADER.VERSION != BINARY_LOG_VERSION || HEADER.RECORDS_OFFSET > DATA.size()
+               || HEADER.SITES_OFFSET < sizeof(HEADER) || HEADER.SITES_OFFSET > HEADER.RECORDS_OFFSET)
+            {
+                NOODLE_INVALID_ARG_ERROR("DECODE_LOG: {} IS VERSION {} OR TRUNCATED", PATH, HEADER.VERSION);
+                return false;
+            }
+
+            const auto CORRUPT = [&](const char* WHAT, U64 OFFSET)
+            {
+                NOODLE_INVALID_ARG_ERROR("DECODE_LOG: {} HAS A CORRUPT {} AT OFFSET {}", PATH, WHAT, OFFSET);
+                return false;
+            };
+
+            struct DECODED_SITE
+            {
+                ERROR_CATEGORY CAT;
+                ERROR_SEVERITY SEV;
+                U32 LINE;
+                std::string FORMAT;
+                std::string FILE;
+                std::string ARGS;
+            };
+
+            // THE SITE TABLE LIES BETWEEN THE HEADER AND THE RECORDS
+            std::vector<DECODED_SITE> SITES;
+            std::size_t CURSOR = HEADER.SITES_OFFSET;
+            const std::size_t SITES_END = HEADER.RECORDS_OFFSET;
+
+            const auto READ_STRING = [&](std::string& OUT)
+            {
+                if(SITES_END - CURSOR < 2) return false;
+
+                U16 LENGTH;
+                std::memcpy(&LENGTH, DATA.data() + CURSOR, 2);
+                if(SITES_END - CURSOR - 2 < LENGTH) return false;
+
+                OUT.assign(reinterpret_cast<const char*>(DATA.data() + CURSOR + 2), LENGTH);
+                CURSOR += 2 + LENGTH;
+                return true;
+            };
+
+            for(U32 INDEX = 0; INDEX < HEADER.SITE_COUNT; INDEX++)
+            {
+                const std::size_t START = CURSOR;
+                if(SITES_END - CURSOR < 8) return CORRUPT("SITE", START);
+
+                DECODED_SITE SITE;
+                SITE.CAT = static_cast<ERROR_CATEGORY>(DATA[CURSOR]);
+                SITE.SEV = static_cast<ERROR_SEVERITY>(DATA[CURSOR + 1]);
+                std::memcpy(&SITE.LINE, DATA.data() + CURSOR + 4, 4);
+                CURSOR += 8;
+
+                if(!READ_STRING(SITE.FORMAT) || !READ_STRING(SITE.FILE) || !READ_STRING(SITE.ARGS))
+                    return CORRUPT("SITE", START);
+
+                SITES.push_back(std::move(SITE));
+            }
+
+            // A LOG WHICH WAS NEVER CLOSED IS READ UP TO IT'S FIRST EMPTY RECORD
+            const bool SEALED = HEADER.TICKS_END != 0;
+            const U64 LIMIT = std::min<U64>(SEALED ? HEADER.RECORDS_END : HEADER.CAPACITY, DATA.size() - HEADER.RECORDS_OFFSET);
+            const double NS_PER_TICK = SEALED && HEADER.TICKS_END != HEADER.TICKS_START
+                ? static_cast<double>(HEADER.NS_END - HEADER.NS_START) / static_cast<double>(HEADER.TICKS_END - HEADER.TICKS_START) : 0.0;
+
+            const U8* RECORDS = DATA.data() + HEADER.RECORDS_OFFSET;
+            fmt::memory_buffer TEXT;
+
+            for(U64 AT = 0; AT + BINARY_RECORD_HEADER <= LIMIT;)
+            {
+                U32 ID, LENGTH;
+                U64 TICKS;
+                std::memcpy(&ID, RECORDS + AT, 4);
+                std::memcpy(&LENGTH, RECORDS + AT + 4, 4);
+                std::memcpy(&TICKS, RECORDS + AT + 8, 8);
+
+                // AN EMPTY RECORD IS WHERE AN UNSEALED LOG STOPPED - ANYTHING ELSE OUT OF RANGE IS CORRUPT
+                if(ID == 0)
+                    break;
+
+                if(ID > SITES.size() || LENGTH > LIMIT - AT - BINARY_RECORD_HEADER)
+                    return CORRUPT("RECORD", HEADER.RECORDS_OFFSET + AT);
+
+                const DECODED_SITE& SITE = SITES[ID - 1];
+                const U8* ARG = RECORDS + AT + BINARY_RECORD_HEADER;
+                const U8* ARGS_END = ARG + LENGTH;
+                fmt::dynamic_format_arg_store<fmt::format_context> STORE;
+                bool VALID = true;
+
+                for(const char CODE : SITE.ARGS)
+                {
+                    const U8 KIND = static_cast<U8>(CODE) & 0xF0;
+                    const U8 SIZE = static_cast<U8>(CODE) & 0x0F;
+
+                    // EVERY VALUE IS RESTORED TO IT'S ORIGINAL TYPE, SO THAT IT'S FORMAT SPEC MEANS THE SAME AS IT DID
+                    // A BOOL IS READ AS A BYTE, AS NOT EVERY BYTE IS A VALID BOOL
+                    const auto LOAD = [&](auto TYPE)
+                    {
+                        decltype(TYPE) VALUE;
+
+                        if(SIZE != sizeof(VALUE) || static_cast<std::size_t>(ARGS_END - ARG) < sizeof(VALUE))
+                        {
+                            VALID = false;
+                            return;
+                        }
+
+                        std::memcpy(&VALUE, ARG, sizeof(VALUE));
+                        ARG += sizeof(VALUE);
+
+                        if constexpr (std::is_same<decltype(TYPE), U8>::value)
+                            if(static_cast<LOG_ARG>(KIND) == LOG_ARG::BOOL) { STORE.push_back(VALUE != 0); return; }
+
+                        STORE.push_back(VALUE);
+                    };
+
+                    switch(static_cast<LOG_ARG>(KIND))
+                    {
+                        case LOG_ARG::BOOL: LOAD(U8{}); break;
+                        case LOG_ARG::CHAR: LOAD(char{}); break;
+                        case LOG_ARG::SIGNED:
+                            if(SIZE == 1) LOAD(S8{}); else if(SIZE == 2) LOAD(S16{}); else if(SIZE == 4) LOAD(S32{}); else LOAD(S64{});
+                            break;
+                        case LOG_ARG::UNSIGNED:
+                            if(SIZE == 1) LOAD(U8{}); else if(SIZE == 2) LOAD(U16{}); else if(SIZE == 4) LOAD(U32{}); else LOAD(U64{});
+                            break;
+                        case LOG_ARG::FLOAT:
+                            if(SIZE == 4) LOAD(float{}); else LOAD(double{});
+                            break;
+                        case LOG_ARG::POINTER: LOAD(static_cast<const void*>(nullptr)); break;
+                        case LOG_ARG::STRING:
+                        {
+                            U16 STRING_LENGTH = 0;
+                            if(ARGS_END - ARG >= 2) std::memcpy(&STRING_LENGTH, ARG, 2);
+
+                            if(ARGS_END - ARG < 2 + STRING_LENGTH)
+                            {
+                                VALID = false;
+                                break;
+                            }
+
+                            STORE.push_back(std::string(reinterpret_cast<const char*>(ARG + 2), STRING_LENGTH));
+                            ARG += 2 + STRING_LENGTH;
+                            break;
+                        }
+                        default: VALID = false; break;
+                    }
+
+                    if(!VALID)
+                        return CORRUPT("RECORD", HEADER.RECORDS_OFFSET + AT);
+                }
+
+                if(ARG != ARGS_END)
+                    return CORRUPT("RECORD", HEADER.RECORDS_OFFSET + AT);
+
+                TEXT.clear();
+
+                if(NS_PER_TICK != 0.0)
+                    fmt::format_to(std::back_inserter(TEXT), "[{}] [{}] [{}:{}]\n{:.3f} US - ", GET_ERR_SEVERITY(SITE.SEV),
+                                   GET_ERR_CATEGORY(SITE.CAT), SITE.FILE, SITE.LINE,
+                                   static_cast<double>(TICKS - HEADER.TICKS_START) * NS_PER_TICK / 1000.0);
+                else
+                    fmt::format_to(std::back_inserter(TEXT), "[{}] [{}] [{}:{}]\n{} TICKS - ", GET_ERR_SEVERITY(SITE.SEV),
+                                   GET_ERR_CATEGORY(SITE.CAT), SITE.FILE, SITE.LINE, TICKS - HEADER.TICKS_START);
+
+                if(SITE.ARGS.empty())
+                    TEXT.append(SITE.FORMAT.data(), SITE.FORMAT.data() + SITE.FORMAT.size());
+                else
+                {
+                    const std::size_t MARK = TEXT.size();
+
+                    try
+                    {
+                        fmt::vformat_to(std::back_inserter(TEXT), SITE.FORMAT, STORE);
+                    }
+                    catch(const fmt::format_error& ERROR)
+                    {
+                        TEXT.resize(MARK);
+                        fmt::format_to(std::back_inserter(TEXT), "<FORMAT ERROR: {}> {}", ERROR.what(), SITE.FORMAT);
+                    }
+                }
+
+                TEXT.append(std::string_view("\n\n"));
+                std::fwrite(TEXT.data(), 1, TEXT.size(), OUTPUT);
+
+                AT += BINARY_RECORD_HEADER + LENGTH;
+            }
+
+            if(HEADER.DROPPED != 0)
+                fmt::print(OUTPUT, "[WARNING] [RESOURCE]\nLOG: {} MESSAGES DROPPED\n\n", HEADER.DROPPED);
+
+            return true;
+        }
+    }
+}
+
+#endif
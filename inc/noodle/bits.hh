@@ -0,0 +1,236 @@
+// COPYRIGHT (C) HARRY CLARK 2025
+// A LIGHTWEIGHT IMPLEMENTATION OF COMMON UTILITIES
+
+// THIS FILE PERTAINS TOWARDS BYTE ORDER AND BIT MANIPULATION HELPERS BUILT ON TOP OF THE COMMON TYPES
+// THE GUESTS THIS LIBRARY IS AIMED AT (68000, SH-2) ARE BIG-ENDIAN WHILST MOST HOSTS ARE NOT,
+// SO SWAPS SIT ON THE HOT PATH OF EVERY 16 AND 32-BIT ACCESS
+//
+// EACH SWAP IS BUILT ON THE COMPILER BUILTIN, WHICH FOLDS AT COMPILE TIME FOR CONSTANTS AND OTHERWISE
+// LOWERS TO A SINGLE BSWAP (OR ROL FOR 16 BITS) - FUSED INTO THE LOAD OR STORE AS A MOVBE WHEN THE TARGET
+// HAS IT, E.G. WITH NOODLE_NATIVE
+
+#ifndef BITS_HH
+#define BITS_HH
+
+// NESTED INCLUDES
+
+#include <common.hh>
+
+// SYSTEM INCLUDES
+
+#include <cstddef>
+#include <cstring>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#elif defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+namespace fujiko
+{
+    namespace bits
+    {
+        // THE BYTE ORDER OF THE HOST, KNOWN AT COMPILE TIME
+        #if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+            static constexpr bool HOST_BIG = true;
+        #else
+            static constexpr bool HOST_BIG = false;
+        #endif
+
+        // REVERSE THE BYTES OF AN 8 TO 64-BIT UNSIGNED VALUE
+        template<typename T>
+        NOODLE_FORCE_INLINE constexpr T BSWAP(T VALUE)
+        {
+            static_assert(std::is_unsigned<T>::value, "BSWAP EXPECTS AN UNSIGNED TYPE");
+
+            #if defined(__GNUC__) || defined(__clang__)
+                if constexpr (sizeof(T) == 1) return VALUE;
+                if constexpr (sizeof(T) == 2) return __builtin_bswap16(VALUE);
+                if constexpr (sizeof(T) == 4) return __builtin_bswap32(VALUE);
+                if constexpr (sizeof(T) == 8) return __builtin_bswap64(VALUE);
+            #else
+                T RESULT = 0;
+
+                for(std::size_t BYTE = 0; BYTE < sizeof(T); BYTE++)
+                    RESULT = static_cast<T>((RESULT << 8) | ((VALUE >> (BYTE * 8)) & 0xFF));
+
+                return RESULT;
+            #endif
+        }
+
+        // CONVERSIONS BETWEEN HOST ORDER AND A FIXED ORDER - EACH IS ITS OWN INVERSE
+        template<typename T>
+        NOODLE_FORCE_INLINE constexpr T BIG(T VALUE) { return HOST_BIG ? VALUE : BSWAP(VALUE); }
+
+        template<typename T>
+        NOODLE_FORCE_INLINE constexpr T LITTLE(T VALUE) { return HOST_BIG ? BSWAP(VALUE) : VALUE; }
+
+        // UNALIGNED LOADS AND STORES IN A FIXED ORDER FROM RAW BYTES, SUCH AS A ROM HEADER OR A FILE FORMAT
+        template<typename T>
+        NOODLE_FORCE_INLINE T LOAD_BIG(const void* SRC)
+        {
+            T VALUE;
+            std::memcpy(&VALUE, SRC, sizeof(T));
+            return BIG(VALUE);
+        }
+
+        template<typename T>
+        NOODLE_FORCE_INLINE void STORE_BIG(void* DST, T VALUE)
+        {
+            VALUE = BIG(VALUE);
+            std::memcpy(DST, &VALUE, sizeof(T));
+        }
+
+        template<typename T>
+        NOODLE_FORCE_INLINE T LOAD_LITTLE(const void* SRC)
+        {
+            T VALUE;
+            std::memcpy(&VALUE, SRC, sizeof(T));
+            return LITTLE(VALUE);
+        }
+
+        template<typename T>
+        NOODLE_FORCE_INLINE void STORE_LITTLE(void* DST, T VALUE)
+        {
+            VALUE = LITTLE(VALUE);
+            std::memcpy(DST, &VALUE, sizeof(T));
+        }
+
+        template<typename T>
+        NOODLE_FORCE_INLINE constexpr T ROTL(T VALUE, U32 SHIFT)
+        {
+            constexpr U32 WIDTH = sizeof(T) * 8;
+            SHIFT &= WIDTH - 1;
+            return SHIFT == 0 ? VALUE : static_cast<T>((VALUE << SHIFT) | (VALUE >> (WIDTH - SHIFT)));
+        }
+
+        template<typename T>
+        NOODLE_FORCE_INLINE constexpr T ROTR(T VALUE, U32 SHIFT)
+        {
+            constexpr U32 WIDTH = sizeof(T) * 8;
+            SHIFT &= WIDTH - 1;
+            return SHIFT == 0 ? VALUE : static_cast<T>((VALUE >> SHIFT) | (VALUE << (WIDTH - SHIFT)));
+        }
+
+        // EXTRACT BITS HI..LO INCLUSIVE, AS LAID OUT IN THE 68000 MANUALS
+        template<U32 HI, U32 LO, typename T>
+        NOODLE_FORCE_INLINE constexpr T EXTRACT(T VALUE)
+        {
+            static_assert(HI >= LO && HI < sizeof(T) * 8, "EXTRACT RANGE OUT OF BOUNDS");
+            constexpr U32 WIDTH = HI - LO + 1;
+            constexpr T MASK = WIDTH >= sizeof(T) * 8 ? static_cast<T>(~T(0)) : static_cast<T>((T(1) << WIDTH) - 1);
+            return static_cast<T>((VALUE >> LO) & MASK);
+        }
+
+        // SIGN EXTEND THE LOW WIDTH BITS OF A VALUE, E.G. SIGN_EXTEND<16>(DISPLACEMENT)
+        template<U32 WIDTH>
+        NOODLE_FORCE_INLINE constexpr S32 SIGN_EXTEND(U32 VALUE)
+        {
+            static_assert(WIDTH > 0 && WIDTH <= 32, "SIGN_EXTEND WIDTH OUT OF BOUNDS");
+            constexpr U32 SIGN = 1U << (WIDTH - 1);
+            const U32 MASKED = WIDTH == 32 ? VALUE : VALUE & ((SIGN << 1) - 1);
+            return static_cast<S32>((MASKED ^ SIGN) - SIGN);
+        }
+
+        template<typename T>
+        NOODLE_FORCE_INLINE constexpr U32 POPCOUNT(T VALUE)
+        {
+            #if defined(__GNUC__) || defined(__clang__)
+                return static_cast<U32>(__builtin_popcountll(VALUE));
+            #else
+                U32 COUNT = 0;
+                for(; VALUE; VALUE &= VALUE - 1) COUNT++;
+                return COUNT;
+            #endif
+        }
+
+        // LEADING AND TRAILING ZERO COUNTS - A ZERO VALUE YIELDS THE FULL WIDTH
+        template<typename T>
+        NOODLE_FORCE_INLINE constexpr U32 CLZ(T VALUE)
+        {
+            constexpr U32 WIDTH = sizeof(T) * 8;
+            if(VALUE == 0) return WIDTH;
+
+            #if defined(__GNUC__) || defined(__clang__)
+                return static_cast<U32>(__builtin_clzll(VALUE)) - (64 - WIDTH);
+            #else
+                U32 COUNT = 0;
+                for(T BIT = T(1) << (WIDTH - 1); !(VALUE & BIT); BIT >>= 1) COUNT++;
+                return COUNT;
+            #endif
+        }
+
+        template<typename T>
+        NOODLE_FORCE_INLINE constexpr U32 CTZ(T VALUE)
+        {
+            if(VALUE == 0) return sizeof(T) * 8;
+
+            #if defined(__GNUC__) || defined(__clang__)
+                return static_cast<U32>(__builtin_ctzll(VALUE));
+            #else
+                U32 COUNT = 0;
+                for(; !(VALUE & 1); VALUE >>= 1) COUNT++;
+                return COUNT;
+            #endif
+        }
+
+        // BULK SWAP OF COUNT ELEMENTS FROM SRC INTO DST, WHICH MAY BE THE SAME BUFFER
+        // THE WIDEST VECTOR UNIT THE BUILD TARGETS IS USED - AVX2 SHUFFLES 32 BYTES AT A TIME,
+        // SSE2 (WITHOUT A BYTE SHUFFLE) SWAPS 16 BYTES THROUGH SHIFTS - WITH THE TAIL AND ANY OTHER TARGET
+        // FALLING BACK TO THE SCALAR SWAP
+        template<typename T>
+        inline void SWAP_BLOCK(T* DST, const T* SRC, std::size_t COUNT)
+        {
+            static_assert(sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8, "SWAP_BLOCK EXPECTS 16, 32 OR 64-BIT ELEMENTS");
+
+            std::size_t INDEX = 0;
+
+            #if defined(__AVX2__)
+                constexpr std::size_t LANES = 32 / sizeof(T);
+                const __m256i ORDER = sizeof(T) == 2
+                    ? _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                                       1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14)
+                    : sizeof(T) == 4
+                    ? _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                       3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12)
+                    : _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+                                       7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+
+                for(; INDEX + LANES <= COUNT; INDEX += LANES)
+                {
+                    const __m256i VALUE = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(SRC + INDEX));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(DST + INDEX), _mm256_shuffle_epi8(VALUE, ORDER));
+                }
+            #elif defined(__SSE2__)
+                constexpr std::size_t LANES = 16 / sizeof(T);
+
+                for(; INDEX + LANES <= COUNT; INDEX += LANES)
+                {
+                    __m128i VALUE = _mm_loadu_si128(reinterpret_cast<const __m128i*>(SRC + INDEX));
+
+                    // REVERSE THE 16-BIT WORDS WITHIN EACH ELEMENT, THEN THE BYTES WITHIN EACH WORD
+                    if constexpr (sizeof(T) == 4)
+                    {
+                        VALUE = _mm_shufflelo_epi16(VALUE, _MM_SHUFFLE(2, 3, 0, 1));
+                        VALUE = _mm_shufflehi_epi16(VALUE, _MM_SHUFFLE(2, 3, 0, 1));
+                    }
+
+                    if constexpr (sizeof(T) == 8)
+                    {
+                        VALUE = _mm_shufflelo_epi16(VALUE, _MM_SHUFFLE(0, 1, 2, 3));
+                        VALUE = _mm_shufflehi_epi16(VALUE, _MM_SHUFFLE(0, 1, 2, 3));
+                    }
+
+                    VALUE = _mm_or_si128(_mm_slli_epi16(VALUE, 8), _mm_srli_epi16(VALUE, 8));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(DST + INDEX), VALUE);
+                }
+            #endif
+
+            for(; INDEX < COUNT; INDEX++)
+                DST[INDEX] = BSWAP(SRC[INDEX]);
+        }
+    }
+}
+
+#endif
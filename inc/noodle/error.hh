@@ -1,202 +1,1152 @@
-// COPYRIGHT (C) HARRY CLARK 2025
-// A LIGHTWEIGHT IMPLEMENTATION OF COMMON UTILITIES 
-
-// THE FOLLOWING FILE PERTAINS TOWARDS THE MODULARISATION AND VERBOSITY OF
-// MY ERROR HANDLING SCHEME
-
-#ifndef ERROR_HH
-#define ERROR_HH
-
-// NESTED INCLUDES  
-#include <common.hh>
-#include <fmt/format.h>
-
-// SYSTEM INCLUDES
-#include <atomic>
-#include <string>
-#include <type_traits>
-#include <utility>
-
-namespace noodle
-{
-    namespace err
-    {
-        // TEMPLATING FOR HANDLING GENERIC ERROR MESSAGE TYPES
-        template<typename T>
-        using ERROR_MESSAGE = typename std::enable_if<std::is_convertible<T, std::string>::value, T>::type;
-
-        enum class ERROR_CATEGORY : U8
-        {
-            LOGIC_ERR = 0,
-            RUNTIME_ERR,
-            RES_ERR,
-            INVALID_ARG,
-            OOB,
-            NULL_PTR,
-            UNIMPL,
-            UNREACH,
-            SYS_ERR,
-            CUSTOM_ERR
-        };
-
-        enum class ERROR_SEVERITY : U8
-        {
-            FATAL = 0,
-            CRITICAL,
-            STD_ERROR,
-            WARNING,
-            INFO
-        };
-
-        // GLOBAL THREAD-SAFE IMPL FOR ERROR COUNT
-        static std::atomic<int> ERROR_COUNT{0};
-
-        // STANDARD HELPER FUNCTION TO ACCOMMODATE FOR ERROR COUNT
-        #define GET_ERROR_CODE() (ERROR_COUNT.fetch_add(1))
-
-        // STANDARD HELPER FUNCTION TO ACCOMMODATE FOR ERROR_SEVERITY
-        #define GET_ERR_SEVERITY(SEV)                       \
-        ((SEV) == ERROR_SEVERITY::FATAL ? "FATAL" :         \
-        (SEV) == ERROR_SEVERITY::CRITICAL ? "CRITICAL" :    \
-        (SEV) == ERROR_SEVERITY::STD_ERROR ? "ERROR" :      \
-        (SEV) == ERROR_SEVERITY::WARNING ? "WARNING" :      \
-        (SEV) == ERROR_SEVERITY::INFO ? "INFO" :            \
-        "UNKNOWN")
-
-        // STANDARD HELPER FUNCTION TO ACCOMMODATE FOR ERROR_CATEGORY
-        #define GET_ERR_CATEGORY(CAT)                       \
-        ((CAT) == ERROR_CATEGORY::LOGIC_ERR ? "LOGIC" :     \
-        (CAT) == ERROR_CATEGORY::RUNTIME_ERR ? "RUNTIME" :  \
-        (CAT) == ERROR_CATEGORY::RES_ERR ? "RESOURCE" :     \
-        (CAT) == ERROR_CATEGORY::INVALID_ARG ? "INVALID_ARG" : \
-        (CAT) == ERROR_CATEGORY::OOB ? "OUT_OF_BOUNDS" :    \
-        (CAT) == ERROR_CATEGORY::NULL_PTR ? "NULL_POINTER" : \
-        (CAT) == ERROR_CATEGORY::UNIMPL ? "UNIMPLEMENTED" : \
-        (CAT) == ERROR_CATEGORY::UNREACH ? "UNREACHABLE" :  \
-        (CAT) == ERROR_CATEGORY::SYS_ERR ? "SYSTEM" :       \
-        (CAT) == ERROR_CATEGORY::CUSTOM_ERR ? "CUSTOM" :    \
-        "UNKNOWN")
-
-        // HELPER FUNCTION TO BE ABLE TO FORMAT A MESSAGE LEVERAGING FMT
-        template<typename STR, typename... ARGS>
-        static inline std::string NOODLE_FMT(ERROR_SEVERITY SEV, STR FMT_STR, ARGS&&... A)
-        {
-            std::string FMT = sizeof...(ARGS) > 0 
-                ? fmt::format(FMT_STR, std::forward<ARGS>(A)...)
-                : std::string(FMT_STR);
-            
-            return fmt::format("{}: {} - {}", GET_ERR_SEVERITY(SEV), GET_ERROR_CODE(), FMT);
-        }
-
-        // OVERLOAD FOR BACKWARD COMPATIBILITY
-        template<typename STR, typename... ARGS>
-        static inline std::string NOODLE_FMT(STR FMT_STR, ARGS&&... A)
-        {
-            return NOODLE_FMT(ERROR_SEVERITY::INFO, FMT_STR, std::forward<ARGS>(A)...);
-        }
-
-        // EXTRA OVERLOAD FUNCTION FOR PRINTING THE ERROR DIRECTLY
-        // AUTOMATICALLY FORMAT THE MESSAGE BEFORE THE PRINT STATEMENT
-        // THIS PRESUPPOSES A GENERIC LENGTH FOR THE MESSAGE AGAINST THE FMT ARG
-        template<typename... ARGS>
-        static inline void NOODLE_PRINT(ERROR_CATEGORY CAT, 
-                                        ERROR_SEVERITY SEV,
-                                        const std::string& FMT_STR, ARGS&&... A)
-        {
-            int ERR_CODE = GET_ERROR_CODE();
-            std::string MSG = sizeof ...(A) > 0
-                ? fmt::format(FMT_STR, std::forward<ARGS>(A)...)
-                : FMT_STR;
-
-            fmt::print("[{}] [{}]\nERROR: {} - {}\n\n", 
-                      GET_ERR_SEVERITY(SEV), GET_ERR_CATEGORY(CAT), 
-                      ERR_CODE, MSG);
-        }
-
-        // BASELINE PRINT ARGUMENT ADJACENT FROM ERROR FORMATTING
-        template<typename... ARGS>
-        static inline void NOODLE_PRINT_BASIC(ARGS&&... A)
-        {
-            fmt::print(std::forward<ARGS>(A)...);
-        }
-    }
-}
-
-    // PRE-PROCESSOR MACROS TO HELP WITH COMPATIBILITY
-    // THE FOLLOWING ACCESSES THE OVERALL PRINT TEMPLATE 
-    // AND PROVIDES UNIQUE MACROS FOR CONTEXT SPECIFIC HANDLERS
-
-    #define NOODLE_ERROR_PRINT(CAT, SEV, FMT_STR, ...) \
-    noodle::err::NOODLE_PRINT(CAT, SEV, FMT_STR, ##__VA_ARGS__)
-
-    #define NOODLE_FATAL(FMT_STR, ...) \
-    noodle::err::NOODLE_PRINT(noodle::err::ERROR_CATEGORY::CUSTOM_ERR, \
-                             noodle::err::ERROR_SEVERITY::FATAL, \
-                             FMT_STR, ##__VA_ARGS__)
-
-    #define NOODLE_CRITICAL(FMT_STR, ...) \
-    noodle::err::NOODLE_PRINT(noodle::err::ERROR_CATEGORY::CUSTOM_ERR, \
-                             noodle::err::ERROR_SEVERITY::CRITICAL, \
-                             FMT_STR, ##__VA_ARGS__)
-
-    #define NOODLE_ERROR(FMT_STR, ...) \
-    noodle::err::NOODLE_PRINT(noodle::err::ERROR_CATEGORY::CUSTOM_ERR, \
-                             noodle::err::ERROR_SEVERITY::STD_ERROR, \
-                             FMT_STR, ##__VA_ARGS__)
-
-    #define NOODLE_WARNING(FMT_STR, ...) \
-    noodle::err::NOODLE_PRINT(noodle::err::ERROR_CATEGORY::CUSTOM_ERR, \
-                             noodle::err::ERROR_SEVERITY::WARNING, \
-                             FMT_STR, ##__VA_ARGS__)
-
-    #define NOODLE_INFO(FMT_STR, ...) \
-    noodle::err::NOODLE_PRINT(noodle::err::ERROR_CATEGORY::CUSTOM_ERR, \
-                             noodle::err::ERROR_SEVERITY::INFO, \
-                             FMT_STR, ##__VA_ARGS__)
-
-    #define NOODLE_LOGIC_ERROR(FMT_STR, ...) \
-    noodle::err::NOODLE_PRINT(noodle::err::ERROR_CATEGORY::LOGIC_ERR, \
-                             noodle::err::ERROR_SEVERITY::STD_ERROR, \
-                             FMT_STR, ##__VA_ARGS__)
-
-    #define NOODLE_RUNTIME_ERROR(FMT_STR, ...) \
-    noodle::err::NOODLE_PRINT(noodle::err::ERROR_CATEGORY::RUNTIME_ERR, \
-                             noodle::err::ERROR_SEVERITY::STD_ERROR, \
-                             FMT_STR, ##__VA_ARGS__)
-
-    #define NOODLE_RESOURCE_ERROR(FMT_STR, ...) \
-    noodle::err::NOODLE_PRINT(noodle::err::ERROR_CATEGORY::RES_ERR, \
-                             noodle::err::ERROR_SEVERITY::STD_ERROR, \
-                             FMT_STR, ##__VA_ARGS__)
-
-    #define NOODLE_INVALID_ARG_ERROR(FMT_STR, ...) \
-    noodle::err::NOODLE_PRINT(noodle::err::ERROR_CATEGORY::INVALID_ARG, \
-                             noodle::err::ERROR_SEVERITY::STD_ERROR, \
-                             FMT_STR, ##__VA_ARGS__)
-
-    #define NOODLE_OOB_ERROR(FMT_STR, ...) \
-    noodle::err::NOODLE_PRINT(noodle::err::ERROR_CATEGORY::OOB, \
-                             noodle::err::ERROR_SEVERITY::STD_ERROR, \
-                             FMT_STR, ##__VA_ARGS__)
-
-    #define NOODLE_NULL_PTR_ERROR(FMT_STR, ...) \
-    noodle::err::NOODLE_PRINT(noodle::err::ERROR_CATEGORY::NULL_PTR, \
-                             noodle::err::ERROR_SEVERITY::STD_ERROR, \
-                             FMT_STR, ##__VA_ARGS__)
-
-    #define NOODLE_UNIMPL_ERROR(FMT_STR, ...) \
-    noodle::err::NOODLE_PRINT(noodle::err::ERROR_CATEGORY::UNIMPL, \
-                             noodle::err::ERROR_SEVERITY::STD_ERROR, \
-                             FMT_STR, ##__VA_ARGS__)
-
-    #define NOODLE_UNREACH_ERROR(FMT_STR, ...) \
-    noodle::err::NOODLE_PRINT(noodle::err::ERROR_CATEGORY::UNREACH, \
-                             noodle::err::ERROR_SEVERITY::STD_ERROR, \
-                             FMT_STR, ##__VA_ARGS__)
-
-    #define NOODLE_SYSTEM_ERROR(FMT_STR, ...) \
-    noodle::err::NOODLE_PRINT(noodle::err::ERROR_CATEGORY::SYS_ERR, \
-                             noodle::err::ERROR_SEVERITY::STD_ERROR, \
-                             FMT_STR, ##__VA_ARGS__)
-
-#endif
+// COPYRIGHT (C) HARRY CLARK 2025
+// A LIGHTWEIGHT IMPLEMENTATION OF COMMON UTILITIES 
+
+// THE FOLLOWING FILE PERTAINS TOWARDS THE MODULARISATION AND VERBOSITY OF
+// MY ERROR HANDLING SCHEME
+
+#ifndef ERROR_HH
+#define ERROR_HH
+
+// NESTED INCLUDES  
+#include <common.hh>
+#include <fmt/format.h>
+
+// SYSTEM INCLUDES
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// THE LEAST SEVERE LEVEL COMPILED IN, BY ERROR_SEVERITY VALUE - 0 KEEPS ONLY FATAL, 4 KEEPS EVERYTHING
+// ANYTHING LESS SEVERE IS REMOVED BY THE NOODLE_* MACROS ENTIRELY, ARGUMENTS INCLUDED
+// THE MACROS EXPAND WHERE THEY ARE USED, SO THIS MAY DIFFER BETWEEN TRANSLATION UNITS
+
+#ifndef NOODLE_LOG_LEVEL
+    #define NOODLE_LOG_LEVEL 4
+#endif
+
+// WHEN SET, THE NOODLE_* MACROS WRITE TO THE BINARY LOG (SEE BINLOG.HH) WHENEVER IT IS OPEN
+
+#ifndef NOODLE_LOG_BINARY
+    #define NOODLE_LOG_BINARY 0
+#endif
+
+namespace noodle
+{
+    namespace err
+    {
+        // TEMPLATING FOR HANDLING GENERIC ERROR MESSAGE TYPES
+        template<typename T>
+        using ERROR_MESSAGE = typename std::enable_if<std::is_convertible<T, std::string>::value, T>::type;
+
+        enum class ERROR_CATEGORY : U8
+        {
+            LOGIC_ERR = 0,
+            RUNTIME_ERR,
+            RES_ERR,
+            INVALID_ARG,
+            OOB,
+            NULL_PTR,
+            UNIMPL,
+            UNREACH,
+            SYS_ERR,
+            CUSTOM_ERR
+        };
+
+        enum class ERROR_SEVERITY : U8
+        {
+            FATAL = 0,
+            CRITICAL,
+            STD_ERROR,
+            WARNING,
+            INFO
+        };
+
+        // NAME LOOKUPS FOR SEVERITY AND CATEGORY - A SINGLE INDEXED LOAD RATHER THAN A CHAIN OF COMPARISONS
+        static constexpr const char* SEVERITY_NAMES[] = { "FATAL", "CRITICAL", "ERROR", "WARNING", "INFO" };
+
+        static constexpr const char* CATEGORY_NAMES[] =
+        {
+            "LOGIC", "RUNTIME", "RESOURCE", "INVALID_ARG", "OUT_OF_BOUNDS",
+            "NULL_POINTER", "UNIMPLEMENTED", "UNREACHABLE", "SYSTEM", "CUSTOM"
+        };
+
+        static constexpr const char* SEVERITY_NAME(ERROR_SEVERITY SEV)
+        {
+            return static_cast<U8>(SEV) < std::size(SEVERITY_NAMES) ? SEVERITY_NAMES[static_cast<U8>(SEV)] : "UNKNOWN";
+        }
+
+        static constexpr const char* CATEGORY_NAME(ERROR_CATEGORY CAT)
+        {
+            return static_cast<U8>(CAT) < std::size(CATEGORY_NAMES) ? CATEGORY_NAMES[static_cast<U8>(CAT)] : "UNKNOWN";
+        }
+
+        #define GET_ERR_SEVERITY(SEV) (noodle::err::SEVERITY_NAME(SEV))
+        #define GET_ERR_CATEGORY(CAT) (noodle::err::CATEGORY_NAME(CAT))
+
+        // RUNTIME COUNTERPART TO NOODLE_LOG_LEVEL, CHECKED BY EVERY MACRO WHICH SURVIVES COMPILATION
+        // LOWERING IT SILENCES LESS SEVERE MESSAGES WITHOUT EVALUATING THEIR ARGUMENTS
+        inline std::atomic<U8> LOG_LEVEL{ static_cast<U8>(ERROR_SEVERITY::INFO) };
+
+        // WHERE SYNCHRONOUS MESSAGES ARE WRITTEN - NULL BEING STDOUT
+        inline std::atomic<std::FILE*> LOG_OUTPUT{ nullptr };
+
+        static inline void SET_LOG_LEVEL(ERROR_SEVERITY SEV) { LOG_LEVEL.store(static_cast<U8>(SEV), std::memory_order_relaxed); }
+        static inline void SET_LOG_OUTPUT(std::FILE* OUTPUT) { LOG_OUTPUT.store(OUTPUT, std::memory_order_relaxed); }
+
+        static NOODLE_FORCE_INLINE bool LOG_ENABLED(ERROR_SEVERITY SEV)
+        {
+            return static_cast<U8>(SEV) <= LOG_LEVEL.load(std::memory_order_relaxed);
+        }
+
+        // A POINT-IN-TIME VIEW OF THE ERROR METRICS, SUMMED ACROSS EVERY THREAD
+        struct METRICS_SNAPSHOT
+        {
+            static constexpr std::size_t CATEGORIES = std::size(CATEGORY_NAMES);
+            static constexpr std::size_t SEVERITIES = std::size(SEVERITY_NAMES);
+
+            U64 COUNTS[CATEGORIES][SEVERITIES] = {};
+            U64 SUPPRESSED = 0;
+
+            U64 COUNT(ERROR_CATEGORY CAT, ERROR_SEVERITY SEV) const
+            {
+                return COUNTS[static_cast<U8>(CAT)][static_cast<U8>(SEV)];
+            }
+
+            U64 CATEGORY(ERROR_CATEGORY CAT) const
+            {
+                U64 SUM = 0;
+                for(std::size_t SEV = 0; SEV < SEVERITIES; SEV++) SUM += COUNTS[static_cast<U8>(CAT)][SEV];
+                return SUM;
+            }
+
+            U64 SEVERITY(ERROR_SEVERITY SEV) const
+            {
+                U64 SUM = 0;
+                for(std::size_t CAT = 0; CAT < CATEGORIES; CAT++) SUM += COUNTS[CAT][static_cast<U8>(SEV)];
+                return SUM;
+            }
+
+            U64 TOTAL() const
+            {
+                U64 SUM = 0;
+                for(std::size_t CAT = 0; CAT < CATEGORIES; CAT++) SUM += CATEGORY(static_cast<ERROR_CATEGORY>(CAT));
+                return SUM;
+            }
+
+            // ONE LINE PER NON-ZERO CATEGORY AND SEVERITY, LAID OUT LIKE THE MESSAGES THEMSELVES
+            std::string TEXT() const
+            {
+                fmt::memory_buffer OUT;
+
+                for(std::size_t CAT = 0; CAT < CATEGORIES; CAT++)
+                    for(std::size_t SEV = 0; SEV < SEVERITIES; SEV++)
+                        if(COUNTS[CAT][SEV] != 0)
+                            fmt::format_to(std::back_inserter(OUT), "[{}] [{}] {}\n", SEVERITY_NAMES[SEV], CATEGORY_NAMES[CAT], COUNTS[CAT][SEV]);
+
+                fmt::format_to(std::back_inserter(OUT), "TOTAL: {} SUPPRESSED: {}\n", TOTAL(), SUPPRESSED);
+                return fmt::to_string(OUT);
+            }
+
+            // THE SAME COUNTS AS JSON, NESTED BY CATEGORY THEN SEVERITY - ZERO COUNTS ARE LEFT OUT
+            std::string JSON() const
+            {
+                fmt::memory_buffer OUT;
+                fmt::format_to(std::back_inserter(OUT), "{{\"total\":{},\"suppressed\":{},\"counts\":{{", TOTAL(), SUPPRESSED);
+
+                bool FIRST_CAT = true;
+
+                for(std::size_t CAT = 0; CAT < CATEGORIES; CAT++)
+                {
+                    if(CATEGORY(static_cast<ERROR_CATEGORY>(CAT)) == 0) continue;
+
+                    fmt::format_to(std::back_inserter(OUT), "{}\"{}\":{{", FIRST_CAT ? "" : ",", CATEGORY_NAMES[CAT]);
+                    FIRST_CAT = false;
+
+                    bool FIRST_SEV = true;
+
+                    for(std::size_t SEV = 0; SEV < SEVERITIES; SEV++)
+                    {
+                        if(COUNTS[CAT][SEV] == 0) continue;
+
+                        fmt::format_to(std::back_inserter(OUT), "{}\"{}\":{}", FIRST_SEV ? "" : ",", SEVERITY_NAMES[SEV], COUNTS[CAT][SEV]);
+                        FIRST_SEV = false;
+                    }
+
+                    OUT.push_back('}');
+                }
+
+                fmt::format_to(std::back_inserter(OUT), "}}}}");
+                return fmt::to_string(OUT);
+            }
+        };
+
+        // PROGRAM-WIDE COUNTS OF EVERY MESSAGE REPORTED, BY CATEGORY AND SEVERITY
+        // EACH THREAD COUNTS INTO IT'S OWN CACHE-LINE ALIGNED SHARD WITH PLAIN LOADS AND STORES, SO REPORTING
+        // FROM MANY THREADS AT ONCE NEVER CONTENDS - THE SHARDS ARE ONLY SUMMED WHEN A SNAPSHOT IS TAKEN
+        //
+        // A SHARD OUTLIVES IT'S THREAD AND IS HANDED TO THE NEXT THREAD TO START, SO NO COUNT IS EVER LOST
+        // AND THREAD CHURN DOESN'T GROW THE REGISTRY. HELD BY AN INLINE FUNCTION, THE REGISTRY IS ONE PER PROGRAM
+        // RATHER THAN ONE PER TRANSLATION UNIT
+        class ERROR_METRICS
+        {
+            public:
+                static ERROR_METRICS& INSTANCE()
+                {
+                    // NEVER DESTROYED, SO THAT THREADS STILL REPORTING DURING EXIT HAVE SOMEWHERE TO COUNT
+                    static ERROR_METRICS* METRICS = new ERROR_METRICS;
+                    return *METRICS;
+                }
+
+                // COUNT A MESSAGE AGAINST THE CALLING THREAD
+                NOODLE_FORCE_INLINE void RECORD(ERROR_CATEGORY CAT, ERROR_SEVERITY SEV)
+                {
+                    BUMP(LOCAL().COUNTS[static_cast<U8>(CAT)][static_cast<U8>(SEV)]);
+                }
+
+                // THE CODE PRINTED ALONGSIDE A MESSAGE - ONE COUNTER FOR THE WHOLE PROGRAM, SO NO TWO MESSAGES EVER SHARE
+                // A CODE, WHICHEVER THREAD (OR REUSED SHARD) WROTE THEM. ONLY TAKEN FOR A MESSAGE WHICH IS ACTUALLY WRITTEN,
+                // SO THE ONE SHARED INCREMENT IS NEVER MORE THAN A SMALL PART OF IT'S COST
+                NOODLE_FORCE_INLINE U64 NEXT_CODE()
+                {
+                    return CODES.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                // COUNT A MESSAGE WHICH WAS REPORTED BUT NEVER WRITTEN, HAVING REPEATED THE ONE BEFORE IT
+                NOODLE_FORCE_INLINE void SUPPRESS()
+                {
+                    BUMP(LOCAL().SUPPRESSED);
+                }
+
+                // SUM EVERY SHARD, LESS WHATEVER HAD BEEN COUNTED AT THE LAST RESET
+                // EACH COUNT IS EXACT, THOUGH THREADS STILL REPORTING MAY LAND EITHER SIDE OF THE SNAPSHOT
+                METRICS_SNAPSHOT SNAPSHOT()
+                {
+                    std::lock_guard<std::mutex> GUARD(LOCK);
+                    METRICS_SNAPSHOT RESULT = SUM();
+
+                    for(std::size_t CAT = 0; CAT < METRICS_SNAPSHOT::CATEGORIES; CAT++)
+                        for(std::size_t SEV = 0; SEV < METRICS_SNAPSHOT::SEVERITIES; SEV++)
+                            RESULT.COUNTS[CAT][SEV] -= BASELINE.COUNTS[CAT][SEV];
+
+                    RESULT.SUPPRESSED -= BASELINE.SUPPRESSED;
+                    return RESULT;
+                }
+
+                // ZERO THE METRICS AS SEEN BY SNAPSHOT - THE SHARDS THEMSELVES ARE ONLY EVER WRITTEN BY THEIR THREAD
+                void RESET()
+                {
+                    std::lock_guard<std::mutex> GUARD(LOCK);
+                    BASELINE = SUM();
+                }
+
+            private:
+                struct alignas(64) METRICS_SHARD
+                {
+                    std::atomic<U64> COUNTS[METRICS_SNAPSHOT::CATEGORIES][METRICS_SNAPSHOT::SEVERITIES] = {};
+                    std::atomic<U64> SUPPRESSED{0};
+                    bool IN_USE = false;
+                };
+
+                // TIES A SHARD TO THE LIFETIME OF A THREAD
+                struct SHARD_HANDLE
+                {
+                    SHARD_HANDLE() : SHARD(INSTANCE().ACQUIRE()) {}
+                    ~SHARD_HANDLE() { INSTANCE().RELEASE(SHARD); }
+
+                    METRICS_SHARD* SHARD;
+                };
+
+                ERROR_METRICS() = default;
+
+                // ONLY THE OWNING THREAD WRITES A SHARD, SO AN INCREMENT NEEDS NO LOCKED INSTRUCTION
+                static NOODLE_FORCE_INLINE void BUMP(std::atomic<U64>& COUNTER)
+                {
+                    COUNTER.store(COUNTER.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                }
+
+                static NOODLE_FORCE_INLINE METRICS_SHARD& LOCAL()
+                {
+                    thread_local SHARD_HANDLE HANDLE;
+                    return *HANDLE.SHARD;
+                }
+
+                METRICS_SHARD* ACQUIRE()
+                {
+                    std::lock_guard<std::mutex> GUARD(LOCK);
+
+                    for(const std::unique_ptr<METRICS_SHARD>& SHARD : SHARDS)
+                    {
+                        if(!SHARD->IN_USE)
+                        {
+                            SHARD->IN_USE = true;
+                            return SHARD.get();
+                        }
+                    }
+
+                    SHARDS.emplace_back(new METRICS_SHARD);
+                    SHARDS.back()->IN_USE = true;
+                    return SHARDS.back().get();
+                }
+
+                void RELEASE(METRICS_SHARD* SHARD)
+                {
+                    std::lock_guard<std::mutex> GUARD(LOCK);
+                    SHARD->IN_USE = false;
+                }
+
+                // EXPECTS THE LOCK TO BE HELD
+                METRICS_SNAPSHOT SUM() const
+                {
+                    METRICS_SNAPSHOT RESULT;
+
+                    for(const std::unique_ptr<METRICS_SHARD>& SHARD : SHARDS)
+                    {
+                        for(std::size_t CAT = 0; CAT < METRICS_SNAPSHOT::CATEGORIES; CAT++)
+                            for(std::size_t SEV = 0; SEV < METRICS_SNAPSHOT::SEVERITIES; SEV++)
+                                RESULT.COUNTS[CAT][SEV] += SHARD->COUNTS[CAT][SEV].load(std::memory_order_relaxed);
+
+                        RESULT.SUPPRESSED += SHARD->SUPPRESSED.load(std::memory_order_relaxed);
+                    }
+
+                    return RESULT;
+                }
+
+                std::mutex LOCK;
+                std::vector<std::unique_ptr<METRICS_SHARD>> SHARDS;
+                METRICS_SNAPSHOT BASELINE;
+                alignas(64) std::atomic<U64> CODES{0};
+        };
+
+        // THE CODE FOR A MESSAGE OF THE GIVEN KIND, COUNTING IT ON THE WAY
+        #define GET_ERROR_CODE(CAT, SEV) (noodle::err::ERROR_METRICS::INSTANCE().RECORD(CAT, SEV), \
+                                          noodle::err::ERROR_METRICS::INSTANCE().NEXT_CODE())
+
+        // WITHIN THIS WINDOW, A THREAD REPEATING IT'S LAST MESSAGE WORD FOR WORD IS COUNTED BUT NOT WRITTEN -
+        // HOW MANY WERE COLLAPSED IS WRITTEN BEFORE IT'S NEXT MESSAGE, OR ONCE THE WINDOW HAS PASSED, WHICHEVER IS FIRST.
+        // ZERO, THE DEFAULT, WRITES EVERYTHING - SEE SET_LOG_REPEAT_WINDOW
+        inline std::atomic<U64> LOG_REPEAT_WINDOW{0};
+
+        // HELPER FUNCTION TO BE ABLE TO FORMAT A MESSAGE LEVERAGING FMT
+        template<typename STR, typename... ARGS>
+        static inline std::string NOODLE_FMT(ERROR_SEVERITY SEV, STR FMT_STR, ARGS&&... A)
+        {
+            std::string FMT = sizeof...(ARGS) > 0 
+                ? fmt::format(FMT_STR, std::forward<ARGS>(A)...)
+                : std::string(FMT_STR);
+            
+            return fmt::format("{}: {} - {}", GET_ERR_SEVERITY(SEV), GET_ERROR_CODE(ERROR_CATEGORY::CUSTOM_ERR, SEV), FMT);
+        }
+
+        // OVERLOAD FOR BACKWARD COMPATIBILITY
+        template<typename STR, typename... ARGS>
+        static inline std::string NOODLE_FMT(STR FMT_STR, ARGS&&... A)
+        {
+            return NOODLE_FMT(ERROR_SEVERITY::INFO, FMT_STR, std::forward<ARGS>(A)...);
+        }
+
+        // WHAT AN ASYNCHRONOUS LOG DOES WITH A MESSAGE WHEN IT'S RING IS FULL
+        // DROP DISCARDS IT, BLOCK WAITS FOR ROOM, COUNT DISCARDS IT AND LATER REPORTS HOW MANY WERE LOST
+        enum class LOG_OVERFLOW : U8
+        {
+            DROP = 0,
+            BLOCK,
+            COUNT
+        };
+
+        struct LOG_CONFIG
+        {
+            std::size_t CAPACITY = 1024;
+            LOG_OVERFLOW OVERFLOW = LOG_OVERFLOW::COUNT;
+            std::FILE* OUTPUT = stdout;
+        };
+
+        // A FORMAT STRING CHECKED AT COMPILE TIME (FMT_STRING) IS AN EMPTY TYPE VIEWING A STRING LITERAL,
+        // SO IT OUTLIVES ANY CALL - AND IT'S TYPE IS PARTICULAR TO IT'S CALL SITE. ANY OTHER FORMAT STRING IS NEITHER
+        template<typename S>
+        inline constexpr bool STATIC_FORMAT = std::is_empty_v<S> && std::is_convertible_v<const S&, fmt::string_view>;
+
+        template<typename T>
+        inline constexpr bool STRING_ARGUMENT = std::is_convertible_v<const T&, std::string_view>;
+
+        // OPT-IN ASYNCHRONOUS BACKEND FOR NOODLE_PRINT
+        // ONCE STARTED, A CALLER COPIES IT'S FORMAT STRING AND ARGUMENTS INTO A SLOT OF A BOUNDED MULTI-PRODUCER RING
+        // AND CARRIES ON - A SINGLE BACKGROUND THREAD DRAINS THE RING, FORMATS EACH RECORD AND WRITES THEM OUT
+        // IN BATCHES, SO AN EMULATION THREAD NEVER WAITS ON EITHER THE FORMATTING OR THE OUTPUT
+        //
+        // ONLY ARGUMENTS WHICH CAN BE HELD BY VALUE ARE DEFERRED - NUMBERS, POINTERS AND STRINGS (COPIED INTO THE SLOT).
+        // A MESSAGE WITH ANY OTHER ARGUMENT, OR A FORMAT STRING NOT CHECKED AT COMPILE TIME, IS FORMATTED BY IT'S CALLER
+        //
+        // EACH SLOT CARRIES A SEQUENCE NUMBER WHICH HANDS IT BACK AND FORTH BETWEEN PRODUCERS AND THE CONSUMER,
+        // SO CLAIMING A SLOT IS A SINGLE COMPARE AND SWAP - AND ONCE CLAIMED, A SLOT IS ALWAYS PUBLISHED, EVEN WHEN
+        // IT'S MESSAGE FAILS TO FORMAT. PRODUCERS ARE COUNTED IN AND OUT, SO STOP AND START WAIT FOR ANY STILL WRITING
+        //
+        // STRINGS AND CALLER FORMATTED MESSAGES LONGER THAN A SLOT ARE TRUNCATED. THE LOG IS STOPPED (AND FLUSHED)
+        // AT EXIT, AND A FATAL MESSAGE FLUSHES EVERYTHING BEFORE IT RETURNS
+        class ASYNC_LOG
+        {
+            public:
+                static constexpr std::size_t MESSAGE_SIZE = 240;
+                static constexpr std::size_t ARGUMENT_SIZE = 128;
+
+                static ASYNC_LOG& INSTANCE()
+                {
+                    static ASYNC_LOG LOG;
+                    return LOG;
+                }
+
+                ~ASYNC_LOG() { STOP(); }
+
+                bool START(const LOG_CONFIG& CONFIG = LOG_CONFIG{})
+                {
+                    std::lock_guard<std::mutex> GUARD(CONTROL);
+
+                    if(ACTIVE() || CONFIG.CAPACITY < 2 || (CONFIG.CAPACITY & (CONFIG.CAPACITY - 1)))
+                        return false;
+
+                    RING.reset(new LOG_RECORD[CONFIG.CAPACITY]);
+                    for(std::size_t INDEX = 0; INDEX < CONFIG.CAPACITY; INDEX++)
+                        RING[INDEX].SEQUENCE.store(INDEX, std::memory_order_relaxed);
+
+                    MASK = CONFIG.CAPACITY - 1;
+                    OVERFLOW = CONFIG.OVERFLOW;
+                    OUTPUT = CONFIG.OUTPUT;
+                    HEAD.store(0, std::memory_order_relaxed);
+                    TAIL.store(0, std::memory_order_relaxed);
+                    DROPS.store(0, std::memory_order_relaxed);
+                    REPORTED = 0;
+
+                    static const bool AT_EXIT = std::atexit([] { INSTANCE().STOP(); }) == 0;
+                    (void)AT_EXIT;
+
+                    QUIT.store(false, std::memory_order_relaxed);
+                    WORKER = std::thread([this] { DRAIN(); });
+                    RUNNING.store(true);
+                    return true;
+                }
+
+                // DRAIN WHATEVER IS LEFT, THEN RETURN NOODLE_PRINT TO PRINTING ON THE CALLING THREAD
+                // ONCE NO NEW PRODUCER CAN GET IN, THE WORKER IS ONLY TOLD TO QUIT AFTER THE LAST ONE STILL WRITING HAS LEFT
+                void STOP()
+                {
+                    std::lock_guard<std::mutex> GUARD(CONTROL);
+
+                    if(!RUNNING.exchange(false))
+                        return;
+
+                    while(PRODUCERS.load() != 0)
+                        std::this_thread::yield();
+
+                    QUIT.store(true, std::memory_order_release);
+                    WORKER.join();
+                }
+
+                // WAIT UNTIL EVERY MESSAGE PUSHED BEFORE THE CALL HAS BEEN WRITTEN OUT
+                void FLUSH() const
+                {
+                    const U64 TARGET = TAIL.load(std::memory_order_acquire);
+
+                    while(ACTIVE() && HEAD.load(std::memory_order_acquire) < TARGET)
+                        std::this_thread::yield();
+                }
+
+                bool ACTIVE() const { return RUNNING.load(std::memory_order_relaxed); }
+                U64 DROPPED() const { return DROPS.load(std::memory_order_relaxed); }
+
+                // FALSE WHEN THE MESSAGE WAS DROPPED, OR THE LOG WAS STOPPED BEFORE IT COULD BE PUSHED
+                template<typename S, typename... ARGS>
+                bool PUSH(ERROR_CATEGORY CAT, ERROR_SEVERITY SEV, U64 CODE, const S& FMT_STR, ARGS&&... A)
+                {
+                    // COUNTED IN BEFORE CHECKING THE LOG IS STILL RUNNING, AS STOP CLEARS THAT BEFORE COUNTING US
+                    PRODUCERS.fetch_add(1);
+                    const bool PUSHED = RUNNING.load() && CLAIM(CAT, SEV, CODE, FMT_STR, std::forward<ARGS>(A)...);
+                    PRODUCERS.fetch_sub(1, std::memory_order_release);
+                    return PUSHED;
+                }
+
+            private:
+                template<typename T>
+                static constexpr bool CAPTURED_ARGUMENT = std::is_arithmetic_v<T> || std::is_same_v<T, const void*>
+                                                       || std::is_same_v<T, void*> || STRING_ARGUMENT<T>;
+
+                // WHAT AN ARGUMENT IS HELD AS ONCE COPIED INTO A SLOT - A STRING BECOMES A VIEW OF IT'S COPY
+                template<typename T>
+                using CAPTURED_TYPE = std::conditional_t<STRING_ARGUMENT<T>, fmt::string_view, T>;
+
+                template<typename... ARGS>
+                using CAPTURED_STORE = fmt::format_arg_store<fmt::format_context, CAPTURED_TYPE<std::decay_t<ARGS>>...>;
+
+                template<typename S, typename... ARGS>
+                static constexpr bool DEFERRED()
+                {
+                    if constexpr (sizeof...(ARGS) == 0 || !STATIC_FORMAT<S> || !(CAPTURED_ARGUMENT<std::decay_t<ARGS>> && ...))
+                        return false;
+                    else
+                        return sizeof(CAPTURED_STORE<ARGS...>) <= ARGUMENT_SIZE;
+                }
+
+                // A NULL STRING IS CAPTURED AS "(NULL)", AS THE BINARY LOG STORES IT, RATHER THAN READ THROUGH
+                template<typename T>
+                static auto CAPTURE(const T& ARG, char*& CURSOR, const char* END)
+                {
+                    if constexpr (STRING_ARGUMENT<T>)
+                    {
+                        std::string_view TEXT("(NULL)");
+
+                        if constexpr (std::is_pointer_v<T>)
+                        {
+                            if(ARG != nullptr)
+                                TEXT = std::string_view(ARG);
+                        }
+                        else
+                            TEXT = std::string_view(ARG);
+
+                        const std::size_t LENGTH = std::min<std::size_t>(TEXT.size(), END - CURSOR);
+                        std::memcpy(CURSOR, TEXT.data(), LENGTH);
+
+                        CURSOR += LENGTH;
+                        return fmt::string_view(CURSOR - LENGTH, LENGTH);
+                    }
+                    else
+                        return ARG;
+                }
+
+                template<typename S, typename... ARGS>
+                bool CLAIM(ERROR_CATEGORY CAT, ERROR_SEVERITY SEV, U64 CODE, const S& FMT_STR, ARGS&&... A)
+                {
+                    U64 POSITION = TAIL.load(std::memory_order_relaxed);
+                    LOG_RECORD* SLOT;
+
+                    for(;;)
+                    {
+                        SLOT = &RING[POSITION & MASK];
+                        const S64 DISTANCE = static_cast<S64>(SLOT->SEQUENCE.load(std::memory_order_acquire) - POSITION);
+
+                        if(DISTANCE == 0)
+                        {
+                            if(TAIL.compare_exchange_weak(POSITION, POSITION + 1, std::memory_order_relaxed))
+                                break;
+                        }
+                        else if(DISTANCE < 0)
+                        {
+                            if(OVERFLOW != LOG_OVERFLOW::BLOCK)
+                            {
+                                DROPS.fetch_add(1, std::memory_order_relaxed);
+                                return false;
+                            }
+
+                            std::this_thread::yield();
+                            POSITION = TAIL.load(std::memory_order_relaxed);
+                        }
+                        else
+                            POSITION = TAIL.load(std::memory_order_relaxed);
+                    }
+
+                    SLOT->CAT = CAT;
+                    SLOT->SEV = SEV;
+                    SLOT->CODE = CODE;
+                    SLOT->FORMAT = fmt::string_view();
+
+                    if constexpr (DEFERRED<S, ARGS...>())
+                    {
+                        char* CURSOR = SLOT->TEXT;
+                        const char* END = SLOT->TEXT + MESSAGE_SIZE;
+
+                        const auto* STORE = ::new(static_cast<void*>(SLOT->ARGUMENTS))
+                            CAPTURED_STORE<ARGS...>{ CAPTURE(A, CURSOR, END)... };
+
+                        SLOT->PACKED = fmt::format_args(*STORE);
+                        SLOT->FORMAT = fmt::string_view(FMT_STR);
+                    }
+                    else if constexpr (sizeof...(ARGS) > 0)
+                    {
+                        try
+                        {
+                            SLOT->LENGTH = static_cast<U16>(fmt::format_to_n(SLOT->TEXT, MESSAGE_SIZE, FMT_STR, std::forward<ARGS>(A)...).out - SLOT->TEXT);
+                        }
+                        catch(const std::exception& ERROR)
+                        {
+                            SLOT->LENGTH = static_cast<U16>(fmt::format_to_n(SLOT->TEXT, MESSAGE_SIZE, "<FORMAT ERROR: {}>", ERROR.what()).out - SLOT->TEXT);
+                        }
+                    }
+                    else
+                    {
+                        const fmt::string_view RAW(FMT_STR);
+                        SLOT->LENGTH = static_cast<U16>(std::min(RAW.size(), MESSAGE_SIZE));
+                        std::memcpy(SLOT->TEXT, RAW.data(), SLOT->LENGTH);
+                    }
+
+                    SLOT->SEQUENCE.store(POSITION + 1, std::memory_order_release);
+                    return true;
+                }
+
+                // A DEFERRED MESSAGE HOLDS IT'S FORMAT STRING AND ARGUMENTS, WITH TEXT HOLDING THE STRINGS THOSE REFER TO -
+                // OTHERWISE FORMAT IS EMPTY AND TEXT HOLDS THE MESSAGE ITSELF
+                struct alignas(64) LOG_RECORD
+                {
+                    std::atomic<U64> SEQUENCE{0};
+                    ERROR_CATEGORY CAT;
+                    ERROR_SEVERITY SEV;
+                    U16 LENGTH;
+                    U64 CODE;
+                    fmt::string_view FORMAT;
+                    fmt::format_args PACKED;
+                    alignas(16) unsigned char ARGUMENTS[ARGUMENT_SIZE];
+                    char TEXT[MESSAGE_SIZE];
+                };
+
+                ASYNC_LOG() = default;
+
+                // RENDER EVERYTHING AVAILABLE INTO ONE BUFFER AND WRITE IT WITH A SINGLE CALL
+                // WHEN THE RING IS EMPTY THE WORKER BACKS OFF, UP TO A MILLISECOND BETWEEN CHECKS
+                void DRAIN()
+                {
+                    fmt::memory_buffer BATCH;
+                    auto IDLE = std::chrono::microseconds(1);
+
+                    for(;;)
+                    {
+                        const bool STOPPING = QUIT.load(std::memory_order_acquire);
+                        U64 POSITION = HEAD.load(std::memory_order_relaxed);
+
+                        while(BATCH.size() < 0x10000)
+                        {
+                            LOG_RECORD& SLOT = RING[POSITION & MASK];
+                            if(SLOT.SEQUENCE.load(std::memory_order_acquire) != POSITION + 1)
+                                break;
+
+                            fmt::format_to(std::back_inserter(BATCH), "[{}] [{}]\nERROR: {} - ",
+                                           GET_ERR_SEVERITY(SLOT.SEV), GET_ERR_CATEGORY(SLOT.CAT), SLOT.CODE);
+
+                            if(SLOT.FORMAT.data() == nullptr)
+                                BATCH.append(SLOT.TEXT, SLOT.TEXT + SLOT.LENGTH);
+                            else
+                            {
+                                const std::size_t MARK = BATCH.size();
+
+                                try
+                                {
+                                    fmt::vformat_to(std::back_inserter(BATCH), SLOT.FORMAT, SLOT.PACKED);
+                                }
+                                catch(const std::exception& ERROR)
+                                {
+                                    BATCH.resize(MARK);
+                                    fmt::format_to(std::back_inserter(BATCH), "<FORMAT ERROR: {}>", ERROR.what());
+                                }
+                            }
+
+                            BATCH.append(std::string_view("\n\n"));
+
+                            SLOT.SEQUENCE.store(POSITION + MASK + 1, std::memory_order_release);
+                            POSITION++;
+                        }
+
+                        const U64 DROPPED_NOW = DROPS.load(std::memory_order_relaxed);
+
+                        if(OVERFLOW == LOG_OVERFLOW::COUNT && DROPPED_NOW != REPORTED)
+                        {
+                            fmt::format_to(std::back_inserter(BATCH), "[WARNING] [RESOURCE]\nLOG: {} MESSAGES DROPPED\n\n",
+                                           DROPPED_NOW - REPORTED);
+                            REPORTED = DROPPED_NOW;
+                        }
+
+                        if(BATCH.size() != 0)
+                        {
+                            std::fwrite(BATCH.data(), 1, BATCH.size(), OUTPUT);
+                            std::fflush(OUTPUT);
+                            BATCH.clear();
+
+                            HEAD.store(POSITION, std::memory_order_release);
+                            IDLE = std::chrono::microseconds(1);
+                            continue;
+                        }
+
+                        if(STOPPING)
+                            return;
+
+                        std::this_thread::sleep_for(IDLE);
+                        IDLE = std::min(IDLE * 2, std::chrono::microseconds(1000));
+                    }
+                }
+
+                std::unique_ptr<LOG_RECORD[]> RING;
+                std::size_t MASK = 0;
+                LOG_OVERFLOW OVERFLOW = LOG_OVERFLOW::COUNT;
+                std::FILE* OUTPUT = stdout;
+                U64 REPORTED = 0;
+                std::thread WORKER;
+
+                alignas(64) std::atomic<U64> TAIL{0};
+                alignas(64) std::atomic<U64> HEAD{0};
+                std::atomic<U64> DROPS{0};
+                std::atomic<bool> RUNNING{false};
+                std::atomic<bool> QUIT{false};
+
+                std::mutex CONTROL;
+                alignas(64) std::atomic<U32> PRODUCERS{0};
+        };
+
+        // WRITE A SINGLE MESSAGE UNDER IT'S CODE - HANDED TO THE ASYNCHRONOUS BACKEND WHEN IT IS RUNNING,
+        // OTHERWISE FORMATTED INTO THE GIVEN BUFFER AND WRITTEN WITH ONE CALL
+        template<typename S, typename... ARGS>
+        static inline void LOG_WRITE(fmt::memory_buffer& BUFFER, ERROR_CATEGORY CAT, ERROR_SEVERITY SEV, U64 CODE, const S& FMT_STR, ARGS&&... A)
+        {
+            ASYNC_LOG& LOG = ASYNC_LOG::INSTANCE();
+
+            // A MESSAGE WHICH LOST A RACE WITH STOP FALLS THROUGH TO BEING WRITTEN HERE
+            if(LOG.ACTIVE() && (LOG.PUSH(CAT, SEV, CODE, FMT_STR, A...) || LOG.ACTIVE()))
+            {
+                if(SEV == ERROR_SEVERITY::FATAL)
+                    LOG.FLUSH();
+
+                return;
+            }
+
+            BUFFER.clear();
+
+            fmt::format_to(std::back_inserter(BUFFER), "[{}] [{}]\nERROR: {} - ",
+                           GET_ERR_SEVERITY(SEV), GET_ERR_CATEGORY(CAT), CODE);
+
+            if constexpr (sizeof...(ARGS) > 0)
+                fmt::format_to(std::back_inserter(BUFFER), FMT_STR, std::forward<ARGS>(A)...);
+            else
+            {
+                const fmt::string_view RAW(FMT_STR);
+                BUFFER.append(RAW.data(), RAW.data() + RAW.size());
+            }
+
+            BUFFER.push_back('\n');
+            BUFFER.push_back('\n');
+
+            std::FILE* OUTPUT = LOG_OUTPUT.load(std::memory_order_relaxed);
+            std::fwrite(BUFFER.data(), 1, BUFFER.size(), OUTPUT ? OUTPUT : stdout);
+        }
+
+        // AS ABOVE, INTO A BUFFER KEPT PER THREAD - SO ONCE THAT BUFFER HAS GROWN TO FIT, A MESSAGE NO LONGER ALLOCATES
+        template<typename S, typename... ARGS>
+        static inline void LOG_WRITE(ERROR_CATEGORY CAT, ERROR_SEVERITY SEV, U64 CODE, const S& FMT_STR, ARGS&&... A)
+        {
+            thread_local fmt::memory_buffer BUFFER;
+            LOG_WRITE(BUFFER, CAT, SEV, CODE, FMT_STR, std::forward<ARGS>(A)...);
+        }
+
+        // THE LAST MESSAGE A THREAD WROTE, AND HOW MANY TIMES IT HAS REPEATED SINCE
+        // KEPT OUTSIDE NOODLE_PRINT SO THAT EVERY FORMAT STRING SHARES THE ONE RECORD
+        //
+        // A MESSAGE IS KNOWN BY IT'S CALL SITE AND THE BYTES OF IT'S ARGUMENTS, OR FAILING THAT BY IT'S FORMATTED TEXT.
+        // THE PENDING COUNT IS PACKED WITH THE KIND OF MESSAGE IT BELONGS TO, SO THAT THE OWNING THREAD AND THE REAPER
+        // CAN EACH TAKE IT WITH A SINGLE ATOMIC OPERATION - A REPEAT IS NEVER LOST, NOR REPORTED TWICE
+        struct LOG_REPEAT
+        {
+            static constexpr U64 COUNT_MASK = (U64{1} << 48) - 1;
+
+            fmt::memory_buffer KEY;
+            fmt::memory_buffer NEXT;
+            const void* SITE = nullptr;
+            ERROR_CATEGORY CAT = ERROR_CATEGORY::CUSTOM_ERR;
+            ERROR_SEVERITY SEV = ERROR_SEVERITY::INFO;
+            std::atomic<U64> PENDING{0};
+            std::atomic<U64> WRITTEN_AT{0};
+
+            static U64 PACK(ERROR_CATEGORY CAT, ERROR_SEVERITY SEV)
+            {
+                return (U64{static_cast<U8>(CAT)} << 56) | (U64{static_cast<U8>(SEV)} << 48);
+            }
+
+            // WRITE HOW MANY REPEATS WERE TAKEN, UNDER THE KIND OF MESSAGE THEY BELONG TO
+            // FORMATTED ON THE STACK, AS THIS ALSO RUNS WHILE THREADS AND THE PROGRAM ARE EXITING
+            static void REPORT(U64 TAKEN)
+            {
+                if((TAKEN & COUNT_MASK) == 0)
+                    return;
+
+                fmt::memory_buffer BUFFER;
+                LOG_WRITE(BUFFER, static_cast<ERROR_CATEGORY>(TAKEN >> 56), static_cast<ERROR_SEVERITY>((TAKEN >> 48) & 0xFF),
+                          ERROR_METRICS::INSTANCE().NEXT_CODE(), FMT_STRING("LAST MESSAGE REPEATED {} TIMES"), TAKEN & COUNT_MASK);
+            }
+
+            // TAKE AND REPORT WHATEVER IS PENDING, LEAVING THE KIND OF MESSAGE IN PLACE FOR ANY LATER REPEATS
+            void FLUSH()
+            {
+                U64 TAKEN = PENDING.load(std::memory_order_relaxed);
+                while((TAKEN & COUNT_MASK) != 0 && !PENDING.compare_exchange_weak(TAKEN, TAKEN & ~COUNT_MASK, std::memory_order_relaxed)) {}
+
+                REPORT(TAKEN);
+            }
+        };
+
+        // EVERY THREAD'S REPEAT RECORD, AND THE REAPER WHICH REPORTS A PENDING COUNT ONCE IT'S WINDOW HAS PASSED -
+        // OTHERWISE A FAULT WHICH REPEATS AND THEN STOPS WOULD ONLY BE SUMMARISED BY WHATEVER THAT THREAD WROTE NEXT.
+        // A THREAD REPORTS IT'S OWN COUNT AS IT EXITS, AND ANY STILL REGISTERED ARE REPORTED AT PROGRAM EXIT
+        class LOG_REPEATS
+        {
+            public:
+                static LOG_REPEATS& INSTANCE()
+                {
+                    // NEVER DESTROYED, AS A THREAD'S RECORD MAY BE RETIRED AFTER STATIC DESTRUCTION HAS BEGUN
+                    static LOG_REPEATS* REPEATS = new LOG_REPEATS;
+                    return *REPEATS;
+                }
+
+                static LOG_REPEAT& LOCAL()
+                {
+                    thread_local ENROLLED RECORD;
+                    return RECORD.REPEAT;
+                }
+
+                // ALREADY RUNNING, THE REAPER IS WOKEN TO PICK UP A CHANGE OF WINDOW - TAKING THE LIST LOCK FIRST MEANS
+                // IT IS EITHER WAITING ALREADY OR HAS YET TO LOOK, SO THE WAKE CANNOT BE MISSED
+                void START()
+                {
+                    std::lock_guard<std::mutex> GUARD(CONTROL);
+
+                    if(REAPER.joinable())
+                    {
+                        { std::lock_guard<std::mutex> LIST(LOCK); }
+                        WAKE.notify_one();
+                        return;
+                    }
+
+                    QUIT = false;
+                    REAPER = std::thread([this] { REAP(); });
+                }
+
+                void STOP()
+                {
+                    std::lock_guard<std::mutex> GUARD(CONTROL);
+
+                    if(!REAPER.joinable())
+                        return;
+
+                    {
+                        std::lock_guard<std::mutex> LIST(LOCK);
+                        QUIT = true;
+                    }
+
+                    WAKE.notify_one();
+                    REAPER.join();
+                }
+
+                // REPORT EVERY PENDING COUNT WHOSE MESSAGE WAS WRITTEN AT LEAST WINDOW NANOSECONDS AGO - ZERO REPORTS ALL
+                void FLUSH(U64 WINDOW)
+                {
+                    std::lock_guard<std::mutex> LIST(LOCK);
+                    FLUSH_LOCKED(WINDOW);
+                }
+
+            private:
+                // THE ASYNCHRONOUS LOG IS BUILT FIRST, SO THAT IT IS STILL THERE WHEN THE FINAL FLUSH RUNS AT EXIT
+                LOG_REPEATS()
+                {
+                    ASYNC_LOG::INSTANCE();
+                    std::atexit([] { INSTANCE().STOP(); INSTANCE().FLUSH(0); });
+                }
+
+                struct ENROLLED
+                {
+                    LOG_REPEAT REPEAT;
+
+                    ENROLLED()
+                    {
+                        LOG_REPEATS& REPEATS = INSTANCE();
+                        std::lock_guard<std::mutex> LIST(REPEATS.LOCK);
+                        REPEATS.RECORDS.push_back(&REPEAT);
+                    }
+
+                    ~ENROLLED()
+                    {
+                        LOG_REPEATS& REPEATS = INSTANCE();
+                        {
+                            std::lock_guard<std::mutex> LIST(REPEATS.LOCK);
+                            REPEATS.RECORDS.erase(std::find(REPEATS.RECORDS.begin(), REPEATS.RECORDS.end(), &REPEAT));
+                        }
+
+                        REPEAT.FLUSH();
+                    }
+                };
+
+                static U64 NOW()
+                {
+                    return static_cast<U64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                               std::chrono::steady_clock::now().time_since_epoch()).count());
+                }
+
+                void FLUSH_LOCKED(U64 WINDOW)
+                {
+                    const U64 TIME = NOW();
+
+                    for(LOG_REPEAT* REPEAT : RECORDS)
+                    {
+                        if(WINDOW == 0 || TIME - REPEAT->WRITTEN_AT.load(std::memory_order_relaxed) >= WINDOW)
+                            REPEAT->FLUSH();
+                    }
+                }
+
+                // WAKES AT HALF THE WINDOW, WITHIN A MILLISECOND TO A SECOND, SO A COUNT IS REPORTED SOON AFTER IT EXPIRES
+                void REAP()
+                {
+                    std::unique_lock<std::mutex> LIST(LOCK);
+
+                    while(!QUIT)
+                    {
+                        const U64 WINDOW = LOG_REPEAT_WINDOW.load(std::memory_order_relaxed);
+                        const U64 PERIOD = std::clamp<U64>(WINDOW / 2, 1000000, 1000000000);
+
+                        WAKE.wait_for(LIST, std::chrono::nanoseconds(PERIOD), [this, WINDOW]
+                        {
+                            return QUIT || LOG_REPEAT_WINDOW.load(std::memory_order_relaxed) != WINDOW;
+                        });
+
+                        if(WINDOW != 0 && WINDOW == LOG_REPEAT_WINDOW.load(std::memory_order_relaxed))
+                            FLUSH_LOCKED(WINDOW);
+                    }
+                }
+
+                std::mutex CONTROL;
+                std::mutex LOCK;
+                std::condition_variable WAKE;
+                std::vector<LOG_REPEAT*> RECORDS;
+                std::thread REAPER;
+                bool QUIT = false;
+        };
+
+        // SETTING A WINDOW STARTS THE REAPER - SETTING ZERO STOPS IT, AND REPORTS EVERY COUNT STILL PENDING
+        static inline void SET_LOG_REPEAT_WINDOW(std::chrono::nanoseconds WINDOW)
+        {
+            LOG_REPEATS& REPEATS = LOG_REPEATS::INSTANCE();
+            LOG_REPEAT_WINDOW.store(static_cast<U64>(std::max<S64>(WINDOW.count(), 0)), std::memory_order_relaxed);
+
+            if(WINDOW.count() > 0)
+                REPEATS.START();
+            else
+            {
+                REPEATS.STOP();
+                REPEATS.FLUSH(0);
+            }
+        }
+
+        // AN ARGUMENT WHOSE BYTES ALONE DECIDE HOW IT FORMATS - A NUMBER, A POINTER OR A STRING
+        template<typename T>
+        inline constexpr bool KEYED_ARGUMENT = std::is_integral_v<T> || std::is_same_v<T, float> || std::is_same_v<T, double>
+                                            || std::is_same_v<T, const void*> || std::is_same_v<T, void*> || STRING_ARGUMENT<T>;
+
+        // ONE ADDRESS PER CALL SITE AND ARGUMENT TYPES
+        template<typename... T>
+        inline constexpr char REPEAT_SITE = 0;
+
+        // APPEND AN ARGUMENT TO A REPEAT KEY - A STRING BY IT'S LENGTH AND CONTENTS, ANYTHING ELSE BY IT'S BYTES
+        // FALSE FOR A NULL STRING, WHICH IS LEFT FOR FMT TO REPORT
+        template<typename T>
+        static inline bool REPEAT_KEY(fmt::memory_buffer& KEY, const T& ARG)
+        {
+            if constexpr (STRING_ARGUMENT<T>)
+            {
+                if constexpr (std::is_pointer_v<T>)
+                {
+                    if(ARG == nullptr)
+                        return false;
+                }
+
+                const std::string_view TEXT(ARG);
+                const std::size_t LENGTH = TEXT.size();
+
+                KEY.append(reinterpret_cast<const char*>(&LENGTH), reinterpret_cast<const char*>(&LENGTH + 1));
+                KEY.append(TEXT.data(), TEXT.data() + TEXT.size());
+            }
+            else
+                KEY.append(reinterpret_cast<const char*>(&ARG), reinterpret_cast<const char*>(&ARG + 1));
+
+            return true;
+        }
+
+        // EXTRA OVERLOAD FUNCTION FOR PRINTING THE ERROR DIRECTLY
+        // AUTOMATICALLY FORMAT THE MESSAGE BEFORE THE PRINT STATEMENT
+        // THIS PRESUPPOSES A GENERIC LENGTH FOR THE MESSAGE AGAINST THE FMT ARG
+        //
+        // WITH A REPEAT WINDOW SET, THE MESSAGE IS COMPARED AGAINST THE LAST ONE THIS THREAD WROTE BEFORE ANYTHING IS
+        // FORMATTED - BY CALL SITE AND ARGUMENT BYTES WHEN THE FORMAT STRING IS CHECKED AT COMPILE TIME AND EVERY
+        // ARGUMENT IS KEYED, OTHERWISE BY IT'S FORMATTED TEXT. A HOT LOOP REPORTING THE SAME FAULT COSTS A COMPARE
+        template<typename S, typename... ARGS>
+        static inline void NOODLE_PRINT(ERROR_CATEGORY CAT,
+                                        ERROR_SEVERITY SEV,
+                                        const S& FMT_STR, ARGS&&... A)
+        {
+            ERROR_METRICS& METRICS = ERROR_METRICS::INSTANCE();
+            const U64 WINDOW = LOG_REPEAT_WINDOW.load(std::memory_order_relaxed);
+            METRICS.RECORD(CAT, SEV);
+
+            if(NOODLE_LIKELY(WINDOW == 0))
+            {
+                LOG_WRITE(CAT, SEV, METRICS.NEXT_CODE(), FMT_STR, std::forward<ARGS>(A)...);
+                return;
+            }
+
+            LOG_REPEAT& REPEAT = LOG_REPEATS::LOCAL();
+            fmt::memory_buffer& KEY = REPEAT.NEXT;
+            const void* SITE = nullptr;
+            KEY.clear();
+
+            if constexpr (STATIC_FORMAT<S> && (KEYED_ARGUMENT<std::decay_t<ARGS>> && ...))
+            {
+                if((REPEAT_KEY<std::decay_t<ARGS>>(KEY, A) && ...))
+                    SITE = &REPEAT_SITE<S, std::decay_t<ARGS>...>;
+                else
+                    KEY.clear();
+            }
+
+            if(SITE == nullptr)
+            {
+                if constexpr (sizeof...(ARGS) > 0)
+                    fmt::format_to(std::back_inserter(KEY), FMT_STR, A...);
+                else
+                {
+                    const fmt::string_view RAW(FMT_STR);
+                    KEY.append(RAW.data(), RAW.data() + RAW.size());
+                }
+            }
+
+            const U64 NOW = static_cast<U64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now().time_since_epoch()).count());
+
+            const bool SAME = SITE == REPEAT.SITE && CAT == REPEAT.CAT && SEV == REPEAT.SEV && KEY.size() == REPEAT.KEY.size()
+                           && std::memcmp(KEY.data(), REPEAT.KEY.data(), KEY.size()) == 0;
+
+            if(SAME && NOW - REPEAT.WRITTEN_AT.load(std::memory_order_relaxed) < WINDOW)
+            {
+                REPEAT.PENDING.fetch_add(1, std::memory_order_relaxed);
+                METRICS.SUPPRESS();
+                return;
+            }
+
+            LOG_REPEAT::REPORT(REPEAT.PENDING.exchange(LOG_REPEAT::PACK(CAT, SEV), std::memory_order_relaxed));
+
+            REPEAT.KEY.clear();
+            REPEAT.KEY.append(KEY.data(), KEY.data() + KEY.size());
+            REPEAT.SITE = SITE;
+            REPEAT.CAT = CAT;
+            REPEAT.SEV = SEV;
+            REPEAT.WRITTEN_AT.store(NOW, std::memory_order_relaxed);
+
+            if(SITE != nullptr)
+                LOG_WRITE(CAT, SEV, METRICS.NEXT_CODE(), FMT_STR, std::forward<ARGS>(A)...);
+            else
+                LOG_WRITE(CAT, SEV, METRICS.NEXT_CODE(), fmt::string_view(KEY.data(), KEY.size()));
+        }
+
+        // BASELINE PRINT ARGUMENT ADJACENT FROM ERROR FORMATTING
+        template<typename... ARGS>
+        static inline void NOODLE_PRINT_BASIC(ARGS&&... A)
+        {
+            fmt::print(std::forward<ARGS>(A)...);
+        }
+    }
+}
+
+    // PRE-PROCESSOR MACROS TO HELP WITH COMPATIBILITY
+    // THE FOLLOWING ACCESSES THE OVERALL PRINT TEMPLATE 
+    // AND PROVIDES UNIQUE MACROS FOR CONTEXT SPECIFIC HANDLERS
+    //
+    // EVERY MACRO FILTERS ON NOODLE_LOG_LEVEL AT COMPILE TIME, THEN ON THE RUNTIME LEVEL, BEFORE ANY ARGUMENT
+    // IS EVALUATED - AND CHECKS IT'S FORMAT STRING AGAINST IT'S ARGUMENTS AT COMPILE TIME THROUGH FMT_STRING
+
+    #if NOODLE_LOG_BINARY
+        #define NOODLE_LOG_EMIT(CAT, SEV, FMT_STR, ...) NOODLE_BINARY_PRINT(CAT, SEV, FMT_STR, ##__VA_ARGS__)
+    #else
+        #define NOODLE_LOG_EMIT(CAT, SEV, FMT_STR, ...) noodle::err::NOODLE_PRINT(CAT, SEV, FMT_STRING(FMT_STR), ##__VA_ARGS__)
+    #endif
+
+    #define NOODLE_ERROR_PRINT(CAT, SEV, FMT_STR, ...) \
+    do \
+    { \
+        if(static_cast<int>(SEV) <= NOODLE_LOG_LEVEL && noodle::err::LOG_ENABLED(SEV)) \
+            NOODLE_LOG_EMIT(CAT, SEV, FMT_STR, ##__VA_ARGS__); \
+    } while(0)
+
+    #define NOODLE_FATAL(FMT_STR, ...) \
+    NOODLE_ERROR_PRINT(noodle::err::ERROR_CATEGORY::CUSTOM_ERR, \
+                       noodle::err::ERROR_SEVERITY::FATAL, \
+                       FMT_STR, ##__VA_ARGS__)
+
+    #define NOODLE_CRITICAL(FMT_STR, ...) \
+    NOODLE_ERROR_PRINT(noodle::err::ERROR_CATEGORY::CUSTOM_ERR, \
+                       noodle::err::ERROR_SEVERITY::CRITICAL, \
+                       FMT_STR, ##__VA_ARGS__)
+
+    #define NOODLE_ERROR(FMT_STR, ...) \
+    NOODLE_ERROR_PRINT(noodle::err::ERROR_CATEGORY::CUSTOM_ERR, \
+                       noodle::err::ERROR_SEVERITY::STD_ERROR, \
+                       FMT_STR, ##__VA_ARGS__)
+
+    #define NOODLE_WARNING(FMT_STR, ...) \
+    NOODLE_ERROR_PRINT(noodle::err::ERROR_CATEGORY::CUSTOM_ERR, \
+                       noodle::err::ERROR_SEVERITY::WARNING, \
+                       FMT_STR, ##__VA_ARGS__)
+
+    #define NOODLE_INFO(FMT_STR, ...) \
+    NOODLE_ERROR_PRINT(noodle::err::ERROR_CATEGORY::CUSTOM_ERR, \
+                       noodle::err::ERROR_SEVERITY::INFO, \
+                       FMT_STR, ##__VA_ARGS__)
+
+    #define NOODLE_LOGIC_ERROR(FMT_STR, ...) \
+    NOODLE_ERROR_PRINT(noodle::err::ERROR_CATEGORY::LOGIC_ERR, \
+                       noodle::err::ERROR_SEVERITY::STD_ERROR, \
+                       FMT_STR, ##__VA_ARGS__)
+
+    #define NOODLE_RUNTIME_ERROR(FMT_STR, ...) \
+    NOODLE_ERROR_PRINT(noodle::err::ERROR_CATEGORY::RUNTIME_ERR, \
+                       noodle::err::ERROR_SEVERITY::STD_ERROR, \
+                       FMT_STR, ##__VA_ARGS__)
+
+    #define NOODLE_RESOURCE_ERROR(FMT_STR, ...) \
+    NOODLE_ERROR_PRINT(noodle::err::ERROR_CATEGORY::RES_ERR, \
+                       noodle::err::ERROR_SEVERITY::STD_ERROR, \
+                       FMT_STR, ##__VA_ARGS__)
+
+    #define NOODLE_INVALID_ARG_ERROR(FMT_STR, ...) \
+    NOODLE_ERROR_PRINT(noodle::err::ERROR_CATEGORY::INVALID_ARG, \
+                       noodle::err::ERROR_SEVERITY::STD_ERROR, \
+                       FMT_STR, ##__VA_ARGS__)
+
+    #define NOODLE_OOB_ERROR(FMT_STR, ...) \
+    NOODLE_ERROR_PRINT(noodle::err::ERROR_CATEGORY::OOB, \
+                       noodle::err::ERROR_SEVERITY::STD_ERROR, \
+                       FMT_STR, ##__VA_ARGS__)
+
+    #define NOODLE_NULL_PTR_ERROR(FMT_STR, ...) \
+    NOODLE_ERROR_PRINT(noodle::err::ERROR_CATEGORY::NULL_PTR, \
+                       noodle::err::ERROR_SEVERITY::STD_ERROR, \
+                       FMT_STR, ##__VA_ARGS__)
+
+    #define NOODLE_UNIMPL_ERROR(FMT_STR, ...) \
+    NOODLE_ERROR_PRINT(noodle::err::ERROR_CATEGORY::UNIMPL, \
+                       noodle::err::ERROR_SEVERITY::STD_ERROR, \
+                       FMT_STR, ##__VA_ARGS__)
+
+    #define NOODLE_UNREACH_ERROR(FMT_STR, ...) \
+    NOODLE_ERROR_PRINT(noodle::err::ERROR_CATEGORY::UNREACH, \
+                       noodle::err::ERROR_SEVERITY::STD_ERROR, \
+                       FMT_STR, ##__VA_ARGS__)
+
+    #define NOODLE_SYSTEM_ERROR(FMT_STR, ...) \
+    NOODLE_ERROR_PRINT(noodle::err::ERROR_CATEGORY::SYS_ERR, \
+                       noodle::err::ERROR_SEVERITY::STD_ERROR, \
+                       FMT_STR, ##__VA_ARGS__)
+
+#if NOODLE_LOG_BINARY
+    #include <noodle/binlog.hh>
+#endif
+
+#endif
@@ -1,197 +1,2741 @@
-// COPYRIGHT (C) HARRY CLARK 2025
-// A LIGHTWEIGHT IMPLEMENTATION OF COMMON UTILITIES 
-
-// THIS FILE PERTAINS TOWARDS THE MODULARISATION OF A FULL FLEDGED MEMORY MAPPER UTILITY
-// MORE SPECIFICALLY, THIS IS A PORT OF THE PRESUPPOSED MEMORY MAPPER DESIGNED SPECIFICALLY FOR
-// SYSTEM EMULATION - CONSTRUCTED OUT OF A VERBOSE MEMORY PAGING SCHEME
-
-// THE FOLLOWING WILL AIM TO PROVIDE AN EASE OF USE MEANS OF BEING ABLE TO INCLUDE
-// THAT ACROSS MULTIPLE INSTANCES - SHOULD IT BE APPLICABLE FOR THE DESIGN OF SAID PROJECT
-// TEMPLATING HELPS ACCORDINGLY WITH THIS TO BE ABLE TO PRESUPPOSE AND FILL IN ANY GENERIC ARGS NEEDED
-
-#ifndef MEMORY_HH
-#define MEMORY_HH
-
-// NESTED INCLUDES
-
-#include <common.hh>
-#include <fmt/core.h>
-
-// SYSTEM INCLUDES
-
-#include <array>
-#include <functional>
-#include <memory>
-#include <vector>
-
-namespace fujiko
-{
-    namespace memory
-    {
-        // GENERIC RAW POINTERS TO HELP WITH READ AND WRITES
-        using FUJIKO_READ_8     = std::function<U8(U32 ADDRESS, void* CTX)>;
-        using FUJIKO_READ_16    = std::function<U16(U32 ADDRESS, void* CTX)>;
-        using FUJIKO_READ_32    = std::function<U32(U32 ADDRESS, void* CTX)>;
-
-        using FUJIKO_WRITE_8    = std::function<void(U32, U8, void*)>;
-        using FUJIKO_WRITE_16   = std::function<void(U32, U16, void*)>;
-        using FUJIKO_WRITE_32   = std::function<void(U32, U32, void*)>;
-
-        // GENERIC CONVERTIBLE CLAUSE FOR BEING ABLE TO CONVERT BETWEEN TWO GENERICS
-        // RETURNS: AN ASSIGNED INTEGRAL CONSTANT
-        template <typename T1, typename T2>
-        static constexpr bool IS_ASSIGNABLE = std::is_convertible<T1, T2>::value;
-
-        // THE FOLLOWING SERVES TO PROVIDE A TYPE-SAFE MEANS OF BEING ABLE TO ASSIGN
-        // RELEVANT SIZES, AND ARGUMENTS IN RELATION TO THE SIZE OF THE MEMORY BUS
-        // WHICH PRESUPPOSES THE ARGS PROVIDED THROUGH A GENERIC
-        template<typename T>
-        static constexpr bool FUJIKO_BUS_HANDLER = IS_ASSIGNABLE<FUJIKO_READ_8, T> 
-                                                        || IS_ASSIGNABLE<FUJIKO_READ_16, T>
-                                                        || IS_ASSIGNABLE<FUJIKO_READ_32, T>
-                                                        || IS_ASSIGNABLE<FUJIKO_WRITE_8, T>
-                                                        || IS_ASSIGNABLE<FUJIKO_WRITE_16, T>
-                                                        || IS_ASSIGNABLE<FUJIKO_WRITE_32, T>;
-
-
-        // THE FOLLOWING REPRESENTS THE OVERARCHING BUS INTERCONNECTING COMPONENTS
-        // KEEP IN MIND THAT THIS IS QUITE A DEPARTURE FROM A STANDARD EMULATION PERSAY.
-        // AS WE ARE ONLY CONCERNED WITH PROVIDING A BASE FOR PAGING, MEMORY MANAGEMENT AND BASIC R/W.
-        // WHENEVER WE CREATE AN INSTANCE OF THE MEMORY BUS, WE WILL PRESUPPOSE
-        // THE DEFAULT ELEMENTS TO BE THE FOLLOWING:
-        //
-        // ADDRESS BITS - TO BE OF THAT IN RELATION TO THE AMOUNT OF REGISTERS
-        // PAGE GRANULARITY - DEFINE THE SMALLEST UNIT OF PROTECTED MEMORY
-        //
-        // THE FOLLOWING PARAMETERS CAN BE CHANGED TO SUIT ANY AND ALL CIRCUMSTANCE
-        class MEMORY_BUS
-        {
-            public:
-                static constexpr U32 ADDRESS_BITS = 27;
-                static constexpr U32 ADDRESS_MASK = (1U << ADDRESS_BITS) - 1;
-                static constexpr U32 PAGE_BITS = 16;
-                static constexpr U32 PAGE_SIZE = 1U << PAGE_BITS;
-                static constexpr U32 PAGE_MASK = PAGE_SIZE - 1;
-                static constexpr U32 PAGE_COUNT = (1U << (ADDRESS_BITS - PAGE_BITS));
-
-            private:
-                // GENERIC BASELINE IMPLEMMENTATION OF A MEMORY PAGE
-                // UTILISES SMART POINTERS TO HELP WITH DELETE AND MOVE CONSTRUCTS
-                struct MEMORY_PAGE
-                {
-                    U8* ARRAY = nullptr;
-                    void* CTX = nullptr;
-                    bool WRITEABLE = false;
-                    bool READONLY = false;
-
-                    memory::FUJIKO_READ_8 READ_8 = nullptr;
-                    memory::FUJIKO_READ_16 READ_16 = nullptr;
-                    memory::FUJIKO_READ_32 READ_32 = nullptr;
-
-                    memory::FUJIKO_WRITE_8 WRITE_8 = nullptr;
-                    memory::FUJIKO_WRITE_16 WRITE_16 = nullptr;
-                    memory::FUJIKO_WRITE_32 WRITE_32 = nullptr;
-                };
-
-                // DYNAMIC TEMPLATE ATTRIBUTE FOR BEING ABLE TO ASSIGN TYPES BASED ON THEIR
-                // PRESUPPOSED STATE - HELPS WITH READS AND WRITES
-                template<typename HANDLER, typename = void>
-                struct HANDLER_ASSIGN;
-
-                template <typename HANDLER>
-                struct HANDLER_ASSIGN<HANDLER,
-                        std::enable_if_t<sizeof(typename HANDLER::value_type) == 1>> 
-                {
-                    static void FUJIKO_ASSIGN_8(MEMORY_PAGE& MEM, HANDLER&& HANDLE) 
-                    {
-                        MEM.READ_8 = READ_8;
-                        MEM.WRITE_8 = WRITE_8;
-                    }
-                };
-
-                template <typename HANDLER>
-                struct HANDLER_ASSIGN<HANDLER,
-                        std::enable_if_t<sizeof(typename HANDLER::value_type) == 2>> 
-                {
-                    static void FUJIKO_ASSIGN_16(MEMORY_PAGE& MEM, HANDLER&& HANDLE) 
-                    {
-                        MEM.READ_16 = READ_16;
-                        MEM.WRITE_16 = WRITE_16;
-                    }
-                };
-
-                template <typename HANDLER>
-                struct HANDLER_ASSIGN<HANDLER,
-                        std::enable_if_t<sizeof(typename HANDLER::value_type) == 4>> 
-                {
-                    static void FUJIKO_ASSIGN_32(MEMORY_PAGE& MEM, HANDLER&& HANDLE) 
-                    {
-                        MEM.READ_32 = READ_32;
-                        MEM.WRITE_32 = WRITE_32;
-                    }
-                };
-
-                // MAP THE CORRESPONDING ELEMENTS 
-                // FOR THE ASSIGNMENT OF THE VALUES THEMSELVES, WE WILL PRESUPPOSE
-                // THAT IT WILL CARRY OUT THE TYPE CONVERSIONS BASED ON THE ARGS PROVIDED
-                //
-                // USING MY HANDLER_ASSIGN TEMPLATE ALLOWS FOR A SIMPLE MEANS OF DISCERNING THE BYTEWISE LENGTH
-                // OF EACH OPERATIONS AND BEING ABLE TO DYNAMICALLY ALLOCATE
-
-            public:
-                alignas(64) std::vector<MEMORY_PAGE> PAGES;
-                MEMORY_BUS() : PAGES(PAGE_COUNT){}
-
-                static U8 READ_8(U32, void*) { return 0; }
-                static U16 READ_16(U32, void*) { return 0; }
-                static U32 READ_32(U32, void*) { return 0; }
-                static void WRITE_8(U32, U8, void*) {}
-                static void WRITE_16(U32, U16, void*) {}
-                static void WRITE_32(U32, U32, void*) {}
-
-                // NOW PRESUPPOSE THAT THERE IS A WAY IN WHICH WE ARE ABLE
-                // TO MAP AN ARRAY OF MEMORY TO A SPECIFIED RANGE
-                //
-                // THIS WILL TAKE ON THE FORM AND UNDERSTANDING OF THE ABOVE
-                // BUT REQUIRES THE POWER OF TWO UTILITY FOR PROPER VALIDATION
-                // OVER CONTINGUOUS MEMORY
-                template<std::size_t ARRAY_SIZE>
-                void MAP_ARRAY(U32 START, U32 END, std::array<U8, ARRAY_SIZE> &ARRAY, bool WRITEABLE)
-                {
-                    static constexpr U32 MASK = ARRAY_SIZE - 1;
-                    
-                    const U32 START_INDEX = START >> PAGE_BITS;
-                    const U32 END_INDEX = END >> PAGE_BITS;
-                    U32 OFFSET = 0;
-
-                    fmt::print("START: 0x{:08X}\n", START);
-                    fmt::print("END: 0x{:08X}\n", END);
-
-                    // ASSUME TO BEGIN WITH THAT ALL HANDLERS HAVE BEEN CLEARED
-                    // FROM THERE, ACCOUNT FOR PROPER SIZING
-
-                    for(U32 INDEX = START_INDEX; INDEX <= END_INDEX; INDEX++)
-                    {
-                        PAGES[INDEX] = MEMORY_PAGE{};
-                        PAGES[INDEX].ARRAY =  &ARRAY[OFFSET & MASK];
-                        PAGES[INDEX].WRITEABLE = WRITEABLE;
-
-                        OFFSET += PAGE_SIZE;
-                    }
-                }
-        };
-
-        // CONSTRUCTOR STRUCT ADJACENT FROM THE BASELINE FUNCTIONALITY
-        // TO BE ABLE TO CREATE METHODS
-        struct MEMORY
-        {
-            MEMORY();
-            void RESET(bool MODE);
-            void MAP_MEMORY(MEMORY_BUS& BUS);
-        };
-
-        alignas(16) std::array<U8, 0x10000> MEMORY_ARRAY;
-    }
-}
-
-#endif
+// COPYRIGHT (C) HARRY CLARK 2025
+// A LIGHTWEIGHT IMPLEMENTATION OF COMMON UTILITIES 
+
+// THIS FILE PERTAINS TOWARDS THE MODULARISATION OF A FULL FLEDGED MEMORY MAPPER UTILITY
+// MORE SPECIFICALLY, THIS IS A PORT OF THE PRESUPPOSED MEMORY MAPPER DESIGNED SPECIFICALLY FOR
+// SYSTEM EMULATION - CONSTRUCTED OUT OF A VERBOSE MEMORY PAGING SCHEME
+
+// THE FOLLOWING WILL AIM TO PROVIDE AN EASE OF USE MEANS OF BEING ABLE TO INCLUDE
+// THAT ACROSS MULTIPLE INSTANCES - SHOULD IT BE APPLICABLE FOR THE DESIGN OF SAID PROJECT
+// TEMPLATING HELPS ACCORDINGLY WITH THIS TO BE ABLE TO PRESUPPOSE AND FILL IN ANY GENERIC ARGS NEEDED
+
+#ifndef MEMORY_HH
+#define MEMORY_HH
+
+// NESTED INCLUDES
+
+#include <common.hh>
+#include <noodle/bits.hh>
+#include <noodle/error.hh>
+#include <noodle/result.hh>
+#include <fmt/core.h>
+
+// SYSTEM INCLUDES
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <cstdio>
+
+// ACCESS PROFILING IS COMPILED OUT UNLESS REQUESTED (SEE THE NOODLE_PROFILE BUILD OPTION)
+// AS IT CHANGES THE LAYOUT OF THE BUS, IT MUST BE THE SAME ACROSS EVERY TRANSLATION UNIT IN A PROGRAM
+
+#ifndef NOODLE_BUS_PROFILE
+    #define NOODLE_BUS_PROFILE 0
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace fujiko
+{
+    namespace memory
+    {
+        // MAPPING ERRORS AND BUS FAULTS ARE RETURNED AS VALUES (SEE RESULT.HH)
+        using noodle::err::RESULT;
+        using noodle::err::ERROR_CATEGORY;
+
+        // GENERIC RAW POINTERS TO HELP WITH READ AND WRITES
+        // THESE ARE PLAIN FUNCTION POINTERS AS OPPOSED TO TYPE-ERASED WRAPPERS, THE DEVICE STATE
+        // IS INSTEAD CARRIED THROUGH THE CONTEXT POINTER REGISTERED ALONGSIDE THE PAGE
+        using FUJIKO_READ_8     = U8(*)(U32 ADDRESS, void* CTX);
+        using FUJIKO_READ_16    = U16(*)(U32 ADDRESS, void* CTX);
+        using FUJIKO_READ_32    = U32(*)(U32 ADDRESS, void* CTX);
+
+        using FUJIKO_WRITE_8    = void(*)(U32, U8, void*);
+        using FUJIKO_WRITE_16   = void(*)(U32, U16, void*);
+        using FUJIKO_WRITE_32   = void(*)(U32, U32, void*);
+
+        // A READ/WRITE PAIR FOR A SINGLE ACCESS WIDTH
+        // THE VALUE TYPE IS WHAT HANDLER_ASSIGN USES TO DISCERN WHICH SLOTS OF THE PAGE TO FILL
+        template<typename T>
+        struct FUJIKO_HANDLER
+        {
+            using value_type = T;
+
+            T (*READ)(U32 ADDRESS, void* CTX) = nullptr;
+            void (*WRITE)(U32 ADDRESS, T VALUE, void* CTX) = nullptr;
+        };
+
+        // COMPILE-TIME BOUND HANDLERS FOR STATICALLY KNOWN DEVICES
+        // THE MEMBER FUNCTION IS A TEMPLATE ARGUMENT, SO THE THUNK BELOW IS A DIRECT CALL
+        // WHICH THE COMPILER IS FREE TO INLINE - LEAVING ONE INDIRECT CALL PER ACCESS
+        template<auto MEMBER>
+        struct FUJIKO_BIND;
+
+        template<typename DEVICE, typename T, T (DEVICE::*MEMBER)(U32)>
+        struct FUJIKO_BIND<MEMBER>
+        {
+            static T CALL(U32 ADDRESS, void* CTX)
+            {
+                return (static_cast<DEVICE*>(CTX)->*MEMBER)(ADDRESS);
+            }
+        };
+
+        template<typename DEVICE, typename T, void (DEVICE::*MEMBER)(U32, T)>
+        struct FUJIKO_BIND<MEMBER>
+        {
+            static void CALL(U32 ADDRESS, T VALUE, void* CTX)
+            {
+                (static_cast<DEVICE*>(CTX)->*MEMBER)(ADDRESS, VALUE);
+            }
+        };
+
+        // CONSTRUCT A HANDLER FROM A PAIR OF DEVICE MEMBER FUNCTIONS
+        // USAGE: FUJIKO_DEVICE_HANDLER<&VDP::READ_16, &VDP::WRITE_16>()
+        template<auto READ, auto WRITE>
+        static constexpr auto FUJIKO_DEVICE_HANDLER()
+        {
+            using VALUE = decltype(FUJIKO_BIND<READ>::CALL(0, nullptr));
+            return FUJIKO_HANDLER<VALUE>{ &FUJIKO_BIND<READ>::CALL, &FUJIKO_BIND<WRITE>::CALL };
+        }
+
+        // GENERIC CONVERTIBLE CLAUSE FOR BEING ABLE TO CONVERT BETWEEN TWO GENERICS
+        // RETURNS: AN ASSIGNED INTEGRAL CONSTANT
+        template <typename T1, typename T2>
+        static constexpr bool IS_ASSIGNABLE = std::is_convertible<T1, T2>::value;
+
+        // THE FOLLOWING SERVES TO PROVIDE A TYPE-SAFE MEANS OF BEING ABLE TO ASSIGN
+        // RELEVANT SIZES, AND ARGUMENTS IN RELATION TO THE SIZE OF THE MEMORY BUS
+        // WHICH PRESUPPOSES THE ARGS PROVIDED THROUGH A GENERIC
+        template<typename T>
+        static constexpr bool FUJIKO_BUS_HANDLER = IS_ASSIGNABLE<T, FUJIKO_HANDLER<U8>>
+                                                        || IS_ASSIGNABLE<T, FUJIKO_HANDLER<U16>>
+                                                        || IS_ASSIGNABLE<T, FUJIKO_HANDLER<U32>>;
+
+        // THE ACCESS WIDTHS SUPPORTED BY THE BUS
+        // ANYTHING ELSE IS REJECTED AT COMPILE TIME BY THE READ AND WRITE TEMPLATES
+        template<typename T>
+        static constexpr bool FUJIKO_BUS_WIDTH = std::is_same<T, U8>::value
+                                                        || std::is_same<T, U16>::value
+                                                        || std::is_same<T, U32>::value;
+
+
+        // DEFAULT BYTE ORDER POLICY FOR THE BUS
+        // VALUES ARE LOADED AND STORED IN HOST ORDER, WITHOUT ANY CONVERSION
+        //
+        // A POLICY CONVERTS BETWEEN THE ORDER BYTES ARE HELD IN GUEST MEMORY AND HOST ORDER,
+        // WITH SWAPS STATING WHETHER THAT CONVERSION DOES ANYTHING ON THIS HOST
+        struct FUJIKO_ENDIAN_NATIVE
+        {
+            static constexpr bool SWAPS = false;
+
+            template<typename T>
+            static constexpr T CONVERT(T VALUE) { return VALUE; }
+        };
+
+        // GUEST MEMORY HELD MOST SIGNIFICANT BYTE FIRST, AS ON THE 68000 AND SH-2
+        struct FUJIKO_ENDIAN_BIG
+        {
+            static constexpr bool SWAPS = !bits::HOST_BIG;
+
+            template<typename T>
+            static constexpr T CONVERT(T VALUE) { return bits::BIG(VALUE); }
+        };
+
+        struct FUJIKO_ENDIAN_LITTLE
+        {
+            static constexpr bool SWAPS = bits::HOST_BIG;
+
+            template<typename T>
+            static constexpr T CONVERT(T VALUE) { return bits::LITTLE(VALUE); }
+        };
+
+        // THE KINDS OF ACCESS A WATCHPOINT CAN BE SET ON, COMBINED AS A MASK
+        namespace watch
+        {
+            static constexpr U8 READ = 1U << 0;
+            static constexpr U8 WRITE = 1U << 1;
+            static constexpr U8 EXECUTE = 1U << 2;
+        }
+
+        // A SINGLE ACCESS WHICH HIT A WATCHPOINT
+        // THE VALUE IS THAT WHICH WAS READ, FETCHED OR WRITTEN - ZERO EXTENDED FROM THE ACCESS SIZE
+        struct FUJIKO_WATCH_EVENT
+        {
+            U32 ADDRESS;
+            U32 SIZE;
+            U32 VALUE;
+            U8 ACCESS;
+        };
+
+        using FUJIKO_WATCH_CALLBACK = void(*)(const FUJIKO_WATCH_EVENT& EVENT, void* CTX);
+
+        // A SINGLE ACCESS CAPTURED BY THE PROFILER'S TRACE, WITH THE SAME ACCESS KINDS AS A WATCHPOINT
+        struct FUJIKO_TRACE_RECORD
+        {
+            U32 ADDRESS;
+            U32 VALUE;
+            U8 SIZE;
+            U8 ACCESS;
+        };
+
+        // ACCESS COUNTS FOR ONE PAGE, INDEXED BY WIDTH (U8, U16, U32)
+        // FETCHES ARE COUNTED AS READS
+        struct FUJIKO_PAGE_HEAT
+        {
+            U32 BASE;
+            U64 READS[3];
+            U64 WRITES[3];
+
+            U64 TOTAL() const
+            {
+                return READS[0] + READS[1] + READS[2] + WRITES[0] + WRITES[1] + WRITES[2];
+            }
+        };
+
+        // HOW A HOST FILE IS MAPPED INTO THE BUS
+        enum class FUJIKO_MAP_MODE : U8
+        {
+            PRIVATE = 0,
+            SHARED
+        };
+
+        // ACCESS PATTERN HINTS PASSED ONTO THE KERNEL FOR A MAPPED FILE
+        enum class FUJIKO_ADVICE : U8
+        {
+            NORMAL = 0,
+            SEQUENTIAL,
+            RANDOM,
+            WILLNEED,
+            HUGEPAGE
+        };
+
+        // OWNING HANDLE OVER A MEMORY MAPPED FILE
+        // A REGION OF ANONYMOUS MEMORY IS RESERVED FIRST, WITH THE FILE THEN MAPPED OVER THE FRONT OF IT -
+        // THIS WAY THE PADDING PAST THE END OF THE FILE READS AS ZERO RATHER THAN RAISING SIGBUS
+        class FUJIKO_FILE_MAPPING
+        {
+            public:
+                FUJIKO_FILE_MAPPING() = default;
+                ~FUJIKO_FILE_MAPPING() { RELEASE(); }
+
+                FUJIKO_FILE_MAPPING(const FUJIKO_FILE_MAPPING&) = delete;
+                FUJIKO_FILE_MAPPING& operator=(const FUJIKO_FILE_MAPPING&) = delete;
+
+                FUJIKO_FILE_MAPPING(FUJIKO_FILE_MAPPING&& OTHER) noexcept
+                    : BASE(std::exchange(OTHER.BASE, nullptr)), LENGTH(std::exchange(OTHER.LENGTH, 0)) {}
+
+                FUJIKO_FILE_MAPPING& operator=(FUJIKO_FILE_MAPPING&& OTHER) noexcept
+                {
+                    if(this != &OTHER)
+                    {
+                        RELEASE();
+                        BASE = std::exchange(OTHER.BASE, nullptr);
+                        LENGTH = std::exchange(OTHER.LENGTH, 0);
+                    }
+
+                    return *this;
+                }
+
+                U8* DATA() const { return static_cast<U8*>(BASE); }
+                std::size_t SIZE() const { return LENGTH; }
+
+                // MAP THE FILE, ROUNDING IT'S LENGTH UP TO A MULTIPLE OF GRANULE
+                // ERRORS CARRY THE ERRNO AS THEIR CODE
+                RESULT<void> OPEN(const char* PATH, std::size_t GRANULE, bool WRITEABLE, FUJIKO_MAP_MODE MODE, FUJIKO_ADVICE ADVICE)
+                {
+                    #if defined(__unix__) || defined(__APPLE__)
+                        const bool SHARED = WRITEABLE && MODE == FUJIKO_MAP_MODE::SHARED;
+                        const int FD = ::open(PATH, SHARED ? O_RDWR : O_RDONLY);
+
+                        if(FD < 0)
+                            return MAKE_ERROR(ERROR_CATEGORY::SYS_ERR, FMT_STRING("MAP_IMAGE: COULD NOT OPEN {} (ERRNO {})"), PATH, errno).WITH_CODE(errno);
+
+                        struct stat INFO;
+                        if(::fstat(FD, &INFO) != 0 || INFO.st_size <= 0)
+                        {
+                            const int CODE = errno;
+                            ::close(FD);
+                            return MAKE_ERROR(ERROR_CATEGORY::SYS_ERR, FMT_STRING("MAP_IMAGE: {} IS EMPTY OR COULD NOT BE QUERIED"), PATH).WITH_CODE(CODE);
+                        }
+
+                        const std::size_t FILE_SIZE = static_cast<std::size_t>(INFO.st_size);
+                        const std::size_t ROUNDED = ((FILE_SIZE + GRANULE - 1) / GRANULE) * GRANULE;
+                        const int PROT = PROT_READ | (WRITEABLE ? PROT_WRITE : 0);
+
+                        void* RESERVED = ::mmap(nullptr, ROUNDED, PROT, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                        if(RESERVED == MAP_FAILED)
+                        {
+                            const int CODE = errno;
+                            ::close(FD);
+                            return MAKE_ERROR(ERROR_CATEGORY::SYS_ERR, FMT_STRING("MAP_IMAGE: COULD NOT RESERVE 0x{:X} BYTES FOR {}"), ROUNDED, PATH).WITH_CODE(CODE);
+                        }
+
+                        void* FILE = ::mmap(RESERVED, FILE_SIZE, PROT, (SHARED ? MAP_SHARED : MAP_PRIVATE) | MAP_FIXED, FD, 0);
+                        const int CODE = errno;
+                        ::close(FD);
+
+                        if(FILE == MAP_FAILED)
+                        {
+                            ::munmap(RESERVED, ROUNDED);
+                            return MAKE_ERROR(ERROR_CATEGORY::SYS_ERR, FMT_STRING("MAP_IMAGE: COULD NOT MAP {} (ERRNO {})"), PATH, CODE).WITH_CODE(CODE);
+                        }
+
+                        RELEASE();
+                        BASE = RESERVED;
+                        LENGTH = ROUNDED;
+
+                        // ADVICE IS ONLY EVER A HINT, SO A KERNEL WHICH DOESN'T SUPPORT IT IS NOT AN ERROR
+                        switch(ADVICE)
+                        {
+                            case FUJIKO_ADVICE::SEQUENTIAL: ::madvise(BASE, LENGTH, MADV_SEQUENTIAL); break;
+                            case FUJIKO_ADVICE::RANDOM: ::madvise(BASE, LENGTH, MADV_RANDOM); break;
+                            case FUJIKO_ADVICE::WILLNEED: ::madvise(BASE, LENGTH, MADV_WILLNEED); break;
+                            #ifdef MADV_HUGEPAGE
+                            case FUJIKO_ADVICE::HUGEPAGE: ::madvise(BASE, LENGTH, MADV_HUGEPAGE); break;
+                            #endif
+                            default: break;
+                        }
+
+                        return noodle::err::SUCCESS();
+                    #else
+                        return MAKE_ERROR(ERROR_CATEGORY::UNIMPL, FMT_STRING("MAP_IMAGE: MEMORY MAPPED FILES ARE NOT SUPPORTED ON THIS PLATFORM ({})"), PATH);
+                    #endif
+                }
+
+            private:
+                void RELEASE()
+                {
+                    #if defined(__unix__) || defined(__APPLE__)
+                        if(BASE != nullptr)
+                            ::munmap(BASE, LENGTH);
+                    #endif
+
+                    BASE = nullptr;
+                    LENGTH = 0;
+                }
+
+                void* BASE = nullptr;
+                std::size_t LENGTH = 0;
+        };
+
+        // THE HOT PAGE TABLE ITSELF, PARAMETERISED OVER IT'S ENTRY COUNT
+        // SMALL GEOMETRIES ARE A SINGLE FLAT ARRAY HELD INLINE WITH THE BUS, WHEREAS WIDE GEOMETRIES
+        // (SUCH AS A FULL 32-BIT SPACE WITH 4KB PAGES) USE A TWO-LEVEL TABLE WHOSE LEAVES ARE ONLY
+        // ALLOCATED ONCE SOMETHING IS MAPPED INTO THEM
+        //
+        // EVERY ENTRY STARTS OUT AS THE FILL VALUE - UNTOUCHED LEAVES ALIAS A SINGLE SHARED LEAF OF FILL VALUES
+        // SO THAT A LOOKUP NEVER HAS TO CHECK FOR A MISSING LEAF
+        static constexpr U32 FUJIKO_FLAT_LIMIT = 1U << 12;
+
+        template<typename ENTRY, U32 COUNT, ENTRY FILL, bool FLAT = (COUNT <= FUJIKO_FLAT_LIMIT)>
+        class FUJIKO_PAGE_TABLE;
+
+        template<typename ENTRY, U32 COUNT, ENTRY FILL>
+        class FUJIKO_PAGE_TABLE<ENTRY, COUNT, FILL, true>
+        {
+            public:
+                FUJIKO_PAGE_TABLE() { TABLE.fill(FILL); }
+
+                NOODLE_FORCE_INLINE ENTRY operator[](U32 INDEX) const { return TABLE[INDEX]; }
+                NOODLE_FORCE_INLINE void SET(U32 INDEX, ENTRY VALUE) { TABLE[INDEX] = VALUE; }
+
+                // WITHOUT CONCURRENT READERS, EDITS APPLY IN PLACE AND THERE IS NOTHING TO RECLAIM -
+                // ANYTHING RETIRED THROUGH AN EDIT IS FREED THERE AND THEN
+                FUJIKO_PAGE_TABLE& EDIT() { return *this; }
+                void RETIRE(std::shared_ptr<void>) {}
+                U32 REGISTER_READER() { return 0; }
+                void QUIESCENT(U32) {}
+                void UNREGISTER_READER(U32) {}
+
+            private:
+                alignas(64) std::array<ENTRY, COUNT> TABLE;
+        };
+
+        template<typename ENTRY, U32 COUNT, ENTRY FILL>
+        class FUJIKO_PAGE_TABLE<ENTRY, COUNT, FILL, false>
+        {
+            public:
+                static constexpr U32 LEAF_BITS = 10;
+                static constexpr U32 LEAF_SIZE = 1U << LEAF_BITS;
+                static constexpr U32 LEAF_MASK = LEAF_SIZE - 1;
+                static constexpr U32 TOP_COUNT = COUNT >> LEAF_BITS;
+
+                FUJIKO_PAGE_TABLE() { TOP.fill(&EMPTY_LEAF()); }
+
+                NOODLE_FORCE_INLINE ENTRY operator[](U32 INDEX) const
+                {
+                    return (*TOP[INDEX >> LEAF_BITS])[INDEX & LEAF_MASK];
+                }
+
+                void SET(U32 INDEX, ENTRY VALUE)
+                {
+                    std::unique_ptr<LEAF>& OWNED = LEAVES[INDEX >> LEAF_BITS];
+
+                    if(!OWNED)
+                    {
+                        OWNED = std::make_unique<LEAF>(EMPTY_LEAF());
+                        TOP[INDEX >> LEAF_BITS] = OWNED.get();
+                    }
+
+                    (*OWNED)[INDEX & LEAF_MASK] = VALUE;
+                }
+
+                FUJIKO_PAGE_TABLE& EDIT() { return *this; }
+                void RETIRE(std::shared_ptr<void>) {}
+                U32 REGISTER_READER() { return 0; }
+                void QUIESCENT(U32) {}
+                void UNREGISTER_READER(U32) {}
+
+            private:
+                using LEAF = std::array<ENTRY, LEAF_SIZE>;
+
+                static const LEAF& EMPTY_LEAF()
+                {
+                    static const LEAF EMPTY = []{ LEAF L; L.fill(FILL); return L; }();
+                    return EMPTY;
+                }
+
+                alignas(64) std::array<const LEAF*, TOP_COUNT> TOP;
+                std::array<std::unique_ptr<LEAF>, TOP_COUNT> LEAVES;
+        };
+
+        // QUIESCENT STATE BASED RECLAMATION FOR SHARED PAGE TABLES
+        // EVERY READER THREAD REGISTERS A SLOT AND PERIODICALLY ANNOUNCES A QUIESCENT STATE - A POINT AT WHICH IT HOLDS
+        // NOTHING LOADED FROM AN OLDER VERSION OF THE TABLE (THE END OF A TIMESLICE, SAY). ANYTHING RETIRED BY A WRITER
+        // IS ONLY FREED ONCE EVERY REGISTERED READER HAS PASSED SUCH A POINT SINCE
+        //
+        // THIS COSTS THE READERS NOTHING PER ACCESS - THE ONLY SHARED WRITE THEY MAKE IS TO THEIR OWN SLOT
+        class FUJIKO_QSBR
+        {
+            public:
+                static constexpr U32 MAX_READERS = 64;
+                static constexpr U64 OFFLINE = ~0ULL;
+
+                U32 REGISTER_READER()
+                {
+                    for(U32 INDEX = 0; INDEX < MAX_READERS; INDEX++)
+                    {
+                        bool EXPECTED = false;
+
+                        if(SLOTS[INDEX].USED.compare_exchange_strong(EXPECTED, true))
+                        {
+                            SLOTS[INDEX].EPOCH.store(EPOCH.load());
+                            return INDEX;
+                        }
+                    }
+
+                    NOODLE_RESOURCE_ERROR("REGISTER_READER: ALL {} READER SLOTS ARE IN USE", MAX_READERS);
+                    return ~0U;
+                }
+
+                void QUIESCENT(U32 SLOT)
+                {
+                    SLOTS[SLOT].EPOCH.store(EPOCH.load());
+                }
+
+                void UNREGISTER_READER(U32 SLOT)
+                {
+                    SLOTS[SLOT].EPOCH.store(OFFLINE);
+                    SLOTS[SLOT].USED.store(false);
+                }
+
+                // FREE WHATEVER EVERY READER HAS MOVED PAST
+                void RECLAIM()
+                {
+                    std::lock_guard<std::mutex> GUARD(WRITER);
+                    RECLAIM_LOCKED();
+                }
+
+                std::size_t RETIRED() const { return GRAVEYARD.size(); }
+
+            protected:
+                // HAND OVER SOMETHING READERS MAY STILL HOLD - ALWAYS CALLED WITH THE WRITER LOCK HELD,
+                // AFTER THE VERSION REPLACING IT HAS BEEN PUBLISHED
+                void RETIRE(std::shared_ptr<void> GARBAGE)
+                {
+                    GRAVEYARD.emplace_back(EPOCH.fetch_add(1) + 1, std::move(GARBAGE));
+                    RECLAIM_LOCKED();
+                }
+
+                void RECLAIM_LOCKED()
+                {
+                    U64 OLDEST = OFFLINE;
+
+                    for(const READER_SLOT& SLOT : SLOTS)
+                        OLDEST = std::min(OLDEST, SLOT.EPOCH.load());
+
+                    GRAVEYARD.erase(std::remove_if(GRAVEYARD.begin(), GRAVEYARD.end(),
+                                    [OLDEST](const auto& GRAVE) { return GRAVE.first <= OLDEST; }), GRAVEYARD.end());
+                }
+
+                std::mutex WRITER;
+
+            private:
+                struct alignas(64) READER_SLOT
+                {
+                    std::atomic<U64> EPOCH{OFFLINE};
+                    std::atomic<bool> USED{false};
+                };
+
+                std::atomic<U64> EPOCH{0};
+                std::array<READER_SLOT, MAX_READERS> SLOTS;
+                std::vector<std::pair<U64, std::shared_ptr<void>>> GRAVEYARD;
+        };
+
+        // A PAGE TABLE WHICH MAY BE REMAPPED WHILST OTHER THREADS ARE READING IT
+        // EVERY VERSION OF THE TABLE IS IMMUTABLE ONCE PUBLISHED - READERS LOAD THE CURRENT VERSION THROUGH A SINGLE
+        // ATOMIC POINTER AND NEVER TAKE A LOCK, WHILST WRITERS SERIALISE ON A MUTEX, BUILD THE NEXT VERSION AS A DRAFT
+        // AND SWAP IT IN WHOLE - SO EVERY EDIT (AN ENTIRE MAPPED RANGE) BECOMES VISIBLE ATOMICALLY
+        //
+        // SMALL GEOMETRIES COPY THE WHOLE FLAT TABLE PER EDIT (16KB FOR THE DEFAULT GEOMETRY), WIDE GEOMETRIES
+        // COPY THE TOP LEVEL AND ONLY THE LEAVES WHICH THE EDIT ACTUALLY TOUCHES
+        template<typename ENTRY, U32 COUNT, ENTRY FILL, bool FLAT = (COUNT <= FUJIKO_FLAT_LIMIT)>
+        class FUJIKO_SHARED_PAGE_TABLE;
+
+        template<typename ENTRY, U32 COUNT, ENTRY FILL>
+        class FUJIKO_SHARED_PAGE_TABLE<ENTRY, COUNT, FILL, true> : public FUJIKO_QSBR
+        {
+            private:
+                struct alignas(64) VERSION
+                {
+                    std::array<ENTRY, COUNT> ENTRIES;
+                };
+
+            public:
+                // NOTHING IS COPIED UNTIL THE FIRST ENTRY WHICH ACTUALLY CHANGES,
+                // AND NOTHING IS PUBLISHED IF NONE DID
+                //
+                // ANYTHING THE EDIT LEAVES UNREFERENCED IS HANDED TO RETIRE, AND ONLY RETIRED ONCE THE EDIT IS PUBLISHED
+                class DRAFT
+                {
+                    public:
+                        explicit DRAFT(FUJIKO_SHARED_PAGE_TABLE& OWNER) : OWNER(OWNER), GUARD(OWNER.WRITER) {}
+
+                        ~DRAFT()
+                        {
+                            if(COPY)
+                                OWNER.PUBLISH(std::move(COPY));
+
+                            for(std::shared_ptr<void>& GARBAGE : RELEASED)
+                                OWNER.RETIRE(std::move(GARBAGE));
+                        }
+
+                        DRAFT(const DRAFT&) = delete;
+                        DRAFT& operator=(const DRAFT&) = delete;
+
+                        ENTRY operator[](U32 INDEX) const
+                        {
+                            return (COPY ? *COPY : *OWNER.LIVE).ENTRIES[INDEX];
+                        }
+
+                        void SET(U32 INDEX, ENTRY VALUE)
+                        {
+                            if(!COPY)
+                            {
+                                if(OWNER.LIVE->ENTRIES[INDEX] == VALUE) return;
+                                COPY = std::make_unique<VERSION>(*OWNER.LIVE);
+                            }
+
+                            COPY->ENTRIES[INDEX] = VALUE;
+                        }
+
+                        void RETIRE(std::shared_ptr<void> GARBAGE)
+                        {
+                            RELEASED.push_back(std::move(GARBAGE));
+                        }
+
+                    private:
+                        FUJIKO_SHARED_PAGE_TABLE& OWNER;
+                        std::lock_guard<std::mutex> GUARD;
+                        std::unique_ptr<VERSION> COPY;
+                        std::vector<std::shared_ptr<void>> RELEASED;
+                };
+
+                FUJIKO_SHARED_PAGE_TABLE() : LIVE(std::make_unique<VERSION>())
+                {
+                    LIVE->ENTRIES.fill(FILL);
+                    CURRENT.store(LIVE.get(), std::memory_order_release);
+                }
+
+                NOODLE_FORCE_INLINE ENTRY operator[](U32 INDEX) const
+                {
+                    return CURRENT.load(std::memory_order_acquire)->ENTRIES[INDEX];
+                }
+
+                DRAFT EDIT() { return DRAFT(*this); }
+
+            private:
+                void PUBLISH(std::unique_ptr<VERSION> NEXT)
+                {
+                    CURRENT.store(NEXT.get(), std::memory_order_release);
+                    std::swap(LIVE, NEXT);
+                    RETIRE(std::shared_ptr<VERSION>(std::move(NEXT)));
+                }
+
+                std::atomic<const VERSION*> CURRENT{nullptr};
+                std::unique_ptr<VERSION> LIVE;
+        };
+
+        template<typename ENTRY, U32 COUNT, ENTRY FILL>
+        class FUJIKO_SHARED_PAGE_TABLE<ENTRY, COUNT, FILL, false> : public FUJIKO_QSBR
+        {
+            public:
+                static constexpr U32 LEAF_BITS = 10;
+                static constexpr U32 LEAF_SIZE = 1U << LEAF_BITS;
+                static constexpr U32 LEAF_MASK = LEAF_SIZE - 1;
+                static constexpr U32 TOP_COUNT = COUNT >> LEAF_BITS;
+
+            private:
+                struct alignas(64) LEAF
+                {
+                    std::array<ENTRY, LEAF_SIZE> ENTRIES;
+                };
+
+                struct alignas(64) VERSION
+                {
+                    std::array<const LEAF*, TOP_COUNT> TOP;
+                };
+
+                // EVERYTHING ONE PUBLISH REPLACES, RETIRED AS A SINGLE UNIT
+                struct GARBAGE
+                {
+                    std::unique_ptr<VERSION> TOP;
+                    std::vector<std::unique_ptr<LEAF>> LEAVES;
+                };
+
+            public:
+                class DRAFT
+                {
+                    public:
+                        explicit DRAFT(FUJIKO_SHARED_PAGE_TABLE& OWNER) : OWNER(OWNER), GUARD(OWNER.WRITER) {}
+
+                        ~DRAFT()
+                        {
+                            if(COPY)
+                                OWNER.PUBLISH(std::move(COPY), std::move(REPLACED));
+
+                            for(std::shared_ptr<void>& GARBAGE : RELEASED)
+                                OWNER.RETIRE(std::move(GARBAGE));
+                        }
+
+                        DRAFT(const DRAFT&) = delete;
+                        DRAFT& operator=(const DRAFT&) = delete;
+
+                        ENTRY operator[](U32 INDEX) const
+                        {
+                            return (COPY ? *COPY : *OWNER.LIVE).TOP[INDEX >> LEAF_BITS]->ENTRIES[INDEX & LEAF_MASK];
+                        }
+
+                        void SET(U32 INDEX, ENTRY VALUE)
+                        {
+                            const U32 SLOT = INDEX >> LEAF_BITS;
+
+                            if(!COPY)
+                            {
+                                if((*this)[INDEX] == VALUE) return;
+                                COPY = std::make_unique<VERSION>(*OWNER.LIVE);
+                                FRESH.assign(TOP_COUNT, false);
+                            }
+
+                            // THE FIRST WRITE TO A LEAF IN THIS DRAFT COPIES IT - THE OLD LEAF
+                            // STAYS VISIBLE TO READERS UNTIL THE DRAFT IS PUBLISHED AND RETIRED
+                            if(!FRESH[SLOT])
+                            {
+                                auto LEAF_COPY = std::make_unique<LEAF>(*COPY->TOP[SLOT]);
+                                COPY->TOP[SLOT] = LEAF_COPY.get();
+
+                                if(OWNER.LEAVES[SLOT])
+                                    REPLACED.push_back(std::move(OWNER.LEAVES[SLOT]));
+
+                                OWNER.LEAVES[SLOT] = std::move(LEAF_COPY);
+                                FRESH[SLOT] = true;
+                            }
+
+                            OWNER.LEAVES[SLOT]->ENTRIES[INDEX & LEAF_MASK] = VALUE;
+                        }
+
+                        void RETIRE(std::shared_ptr<void> GARBAGE)
+                        {
+                            RELEASED.push_back(std::move(GARBAGE));
+                        }
+
+                    private:
+                        FUJIKO_SHARED_PAGE_TABLE& OWNER;
+                        std::lock_guard<std::mutex> GUARD;
+                        std::unique_ptr<VERSION> COPY;
+                        std::vector<bool> FRESH;
+                        std::vector<std::unique_ptr<LEAF>> REPLACED;
+                        std::vector<std::shared_ptr<void>> RELEASED;
+                };
+
+                FUJIKO_SHARED_PAGE_TABLE() : LIVE(std::make_unique<VERSION>())
+                {
+                    LIVE->TOP.fill(&EMPTY_LEAF());
+                    CURRENT.store(LIVE.get(), std::memory_order_release);
+                }
+
+                NOODLE_FORCE_INLINE ENTRY operator[](U32 INDEX) const
+                {
+                    return CURRENT.load(std::memory_order_acquire)->TOP[INDEX >> LEAF_BITS]->ENTRIES[INDEX & LEAF_MASK];
+                }
+
+                DRAFT EDIT() { return DRAFT(*this); }
+
+            private:
+                static const LEAF& EMPTY_LEAF()
+                {
+                    static const LEAF EMPTY = []{ LEAF L; L.ENTRIES.fill(FILL); return L; }();
+                    return EMPTY;
+                }
+
+                void PUBLISH(std::unique_ptr<VERSION> NEXT, std::vector<std::unique_ptr<LEAF>> REPLACED)
+                {
+                    CURRENT.store(NEXT.get(), std::memory_order_release);
+                    std::swap(LIVE, NEXT);
+                    RETIRE(std::make_shared<GARBAGE>(GARBAGE{ std::move(NEXT), std::move(REPLACED) }));
+                }
+
+                std::atomic<const VERSION*> CURRENT{nullptr};
+                std::unique_ptr<VERSION> LIVE;
+                std::array<std::unique_ptr<LEAF>, TOP_COUNT> LEAVES;
+        };
+
+        // THREADING POLICIES FOR THE BUS
+        // NONE - A SINGLE THREAD OWNS THE BUS, AND THE PAGE TABLE IS EDITED IN PLACE
+        // SHARED - ANY NUMBER OF THREADS MAY ACCESS THE BUS WHILST OTHERS REMAP IT, SEE FUJIKO_SHARED_PAGE_TABLE
+        struct FUJIKO_SYNC_NONE
+        {
+            static constexpr bool SHARED = false;
+
+            template<typename ENTRY, U32 COUNT, ENTRY FILL>
+            using PAGE_TABLE = FUJIKO_PAGE_TABLE<ENTRY, COUNT, FILL>;
+
+            using COUNTER = U32;
+        };
+
+        struct FUJIKO_SYNC_SHARED
+        {
+            static constexpr bool SHARED = true;
+
+            template<typename ENTRY, U32 COUNT, ENTRY FILL>
+            using PAGE_TABLE = FUJIKO_SHARED_PAGE_TABLE<ENTRY, COUNT, FILL>;
+
+            using COUNTER = std::atomic<U32>;
+        };
+
+        // THE FOLLOWING REPRESENTS THE OVERARCHING BUS INTERCONNECTING COMPONENTS
+        // KEEP IN MIND THAT THIS IS QUITE A DEPARTURE FROM A STANDARD EMULATION PERSAY.
+        // AS WE ARE ONLY CONCERNED WITH PROVIDING A BASE FOR PAGING, MEMORY MANAGEMENT AND BASIC R/W.
+        // WHENEVER WE CREATE AN INSTANCE OF THE MEMORY BUS, WE WILL PRESUPPOSE
+        // THE DEFAULT ELEMENTS TO BE THE FOLLOWING:
+        //
+        // ADDRESS BITS - TO BE OF THAT IN RELATION TO THE AMOUNT OF REGISTERS
+        // PAGE GRANULARITY - DEFINE THE SMALLEST UNIT OF PROTECTED MEMORY
+        // ENDIAN - THE BYTE ORDER POLICY APPLIED TO RAM ACCESSES (FUJIKO_ENDIAN_NATIVE, _BIG OR _LITTLE)
+        // SYNC - WHETHER THE BUS IS SHARED BETWEEN THREADS
+        //
+        // THE GEOMETRY IS A SET OF TEMPLATE PARAMETERS, SO EVERY MASK AND SHIFT BELOW IS A COMPILE-TIME CONSTANT
+        // E.G. BASIC_MEMORY_BUS<24, 16> FOR THE 68000, BASIC_MEMORY_BUS<32, 12> FOR 4KB MMU PAGES
+        //
+        // WITH FUJIKO_SYNC_SHARED, ACCESSES NEVER LOCK AND EVERY MAP OR UNMAP IS PUBLISHED ATOMICALLY -
+        // EACH READER THREAD SHOULD REGISTER WITH PAGES.REGISTER_READER() AND CALL PAGES.QUIESCENT() BETWEEN TIMESLICES
+        // SO THAT REPLACED TABLES CAN BE FREED. WATCHPOINTS AND DIRTY TRACKING ARE STILL CONFIGURED WITH THE READERS PAUSED,
+        // THOUGH TRACKED WRITES THEMSELVES ARE SERIALISED AND SAFE FROM ANY THREAD
+        template<U32 BUS_ADDRESS_BITS = 27, U32 BUS_PAGE_BITS = 16, typename ENDIAN = FUJIKO_ENDIAN_NATIVE, typename SYNC = FUJIKO_SYNC_NONE>
+        class BASIC_MEMORY_BUS
+        {
+            public:
+                static constexpr U32 ADDRESS_BITS = BUS_ADDRESS_BITS;
+                static constexpr U32 ADDRESS_MASK = static_cast<U32>((1ULL << ADDRESS_BITS) - 1);
+                static constexpr U32 PAGE_BITS = BUS_PAGE_BITS;
+                static constexpr U32 PAGE_SIZE = 1U << PAGE_BITS;
+                static constexpr U32 PAGE_MASK = PAGE_SIZE - 1;
+                static constexpr U32 PAGE_COUNT = (1U << (ADDRESS_BITS - PAGE_BITS));
+
+                static_assert(ADDRESS_BITS <= 32, "THE BUS ADDRESSES AT MOST 32 BITS");
+                static_assert(PAGE_BITS >= 6 && PAGE_BITS < ADDRESS_BITS, "PAGES MUST BE AT LEAST 64 BYTES AND SMALLER THAN THE ADDRESS SPACE");
+
+                // EVERY HOT PAGE ENTRY IS A SINGLE TAGGED POINTER
+                // THE UPPER BITS HOLD THE HOST POINTER FOR RAM (OR THE HANDLER RECORD FOR MMIO)
+                // WHILST THE LOW BITS, FREED UP BY THE ALIGNMENT REQUIREMENT, HOLD THE PAGE FLAGS
+                using PAGE_ENTRY = std::uintptr_t;
+
+                static constexpr U32 PAGE_ALIGN = 64;
+                static constexpr PAGE_ENTRY PAGE_FLAG_MASK = PAGE_ALIGN - 1;
+
+                static constexpr PAGE_ENTRY PAGE_MMIO = 1U << 0;
+                static constexpr PAGE_ENTRY PAGE_WRITEABLE = 1U << 1;
+                static constexpr PAGE_ENTRY PAGE_READONLY = 1U << 2;
+
+                // WRITEABLE RAM WHOSE NEXT WRITE MUST FIRST BE RECORDED BY THE DIRTY TRACKER
+                static constexpr PAGE_ENTRY PAGE_TRACKED = 1U << 3;
+
+                // PAGES OVERLAPPED BY A WATCHPOINT - READ COVERS EXECUTE TOO, AS A FETCH IS A READ
+                static constexpr PAGE_ENTRY PAGE_TRAP_READ = 1U << 4;
+                static constexpr PAGE_ENTRY PAGE_TRAP_WRITE = 1U << 5;
+                static constexpr PAGE_ENTRY PAGE_TRAPS = PAGE_TRAP_READ | PAGE_TRAP_WRITE;
+
+                // AN UNMAPPED PAGE IS AN MMIO PAGE WITHOUT A HANDLER RECORD - IT READS AS OPEN BUS
+                static constexpr PAGE_ENTRY PAGE_UNMAPPED = PAGE_MMIO;
+
+                // ENTRY BITS WHICH FORCE AN ACCESS OFF THE FAST PATH
+                static constexpr PAGE_ENTRY PAGE_READ_SLOW = PAGE_MMIO | PAGE_TRAP_READ;
+                static constexpr PAGE_ENTRY PAGE_WRITE_SLOW = PAGE_MMIO | PAGE_TRACKED | PAGE_TRAP_WRITE;
+
+                // CAN THE PAGE BE READ OR WRITTEN STRAIGHT THROUGH IT'S HOST POINTER
+                static NOODLE_FORCE_INLINE bool READ_DIRECT(PAGE_ENTRY ENTRY)
+                {
+                    return !(ENTRY & PAGE_READ_SLOW);
+                }
+
+                static NOODLE_FORCE_INLINE bool WRITE_DIRECT(PAGE_ENTRY ENTRY)
+                {
+                    return (ENTRY & (PAGE_WRITE_SLOW | PAGE_WRITEABLE)) == PAGE_WRITEABLE;
+                }
+
+                // IS THE PAGE RAM WHICH ONLY NEEDS IT'S WRITES RECORDING BEFORE THEY GO STRAIGHT THROUGH
+                static NOODLE_FORCE_INLINE bool WRITE_TRACKED(PAGE_ENTRY ENTRY)
+                {
+                    return (ENTRY & (PAGE_WRITE_SLOW | PAGE_WRITEABLE)) == (PAGE_TRACKED | PAGE_WRITEABLE);
+                }
+
+                // COLD HANDLER RECORD FOR MMIO PAGES
+                // EVERY HANDLER IS A RAW FUNCTION POINTER WHICH SHARES THE RECORD'S CONTEXT
+                // A SINGLE RECORD IS SHARED BY EVERY PAGE OF THE RANGE IT WAS MAPPED TO
+                struct alignas(PAGE_ALIGN) MEMORY_HANDLERS
+                {
+                    void* CTX = nullptr;
+
+                    memory::FUJIKO_READ_8 READ_8 = nullptr;
+                    memory::FUJIKO_READ_16 READ_16 = nullptr;
+                    memory::FUJIKO_READ_32 READ_32 = nullptr;
+
+                    memory::FUJIKO_WRITE_8 WRITE_8 = nullptr;
+                    memory::FUJIKO_WRITE_16 WRITE_16 = nullptr;
+                    memory::FUJIKO_WRITE_32 WRITE_32 = nullptr;
+                };
+
+            private:
+                // DYNAMIC TEMPLATE ATTRIBUTE FOR BEING ABLE TO ASSIGN TYPES BASED ON THEIR
+                // PRESUPPOSED STATE - HELPS WITH READS AND WRITES
+                template<typename HANDLER, typename = void>
+                struct HANDLER_ASSIGN;
+
+                template <typename HANDLER>
+                struct HANDLER_ASSIGN<HANDLER,
+                        std::enable_if_t<sizeof(typename HANDLER::value_type) == 1>> 
+                {
+                    static void FUJIKO_ASSIGN(MEMORY_HANDLERS& MEM, const HANDLER& HANDLE) 
+                    {
+                        MEM.READ_8 = HANDLE.READ;
+                        MEM.WRITE_8 = HANDLE.WRITE;
+                    }
+                };
+
+                template <typename HANDLER>
+                struct HANDLER_ASSIGN<HANDLER,
+                        std::enable_if_t<sizeof(typename HANDLER::value_type) == 2>> 
+                {
+                    static void FUJIKO_ASSIGN(MEMORY_HANDLERS& MEM, const HANDLER& HANDLE) 
+                    {
+                        MEM.READ_16 = HANDLE.READ;
+                        MEM.WRITE_16 = HANDLE.WRITE;
+                    }
+                };
+
+                template <typename HANDLER>
+                struct HANDLER_ASSIGN<HANDLER,
+                        std::enable_if_t<sizeof(typename HANDLER::value_type) == 4>> 
+                {
+                    static void FUJIKO_ASSIGN(MEMORY_HANDLERS& MEM, const HANDLER& HANDLE) 
+                    {
+                        MEM.READ_32 = HANDLE.READ;
+                        MEM.WRITE_32 = HANDLE.WRITE;
+                    }
+                };
+
+                // RESOLVE THE HANDLER RECORD BEHIND AN MMIO ENTRY
+                static NOODLE_FORCE_INLINE const MEMORY_HANDLERS* PAGE_RECORD(PAGE_ENTRY ENTRY)
+                {
+                    return reinterpret_cast<const MEMORY_HANDLERS*>(ENTRY & ~PAGE_FLAG_MASK);
+                }
+
+                // SLOW PATH FOR READS
+                // MMIO PAGES DISPATCH TO THEIR HANDLER FOR THE GIVEN WIDTH, UNMAPPED PAGES READ AS OPEN BUS (ZERO)
+                // AND AN ACCESS STRADDLING TWO PAGES IS COMPOSED BYTE BY BYTE, AS THOUGH IT WERE ONE CONTIGUOUS LOAD
+                // HANDLERS ALWAYS SEE THE LOGICAL VALUE, THE BYTE ORDER POLICY ONLY APPLIES TO RAM
+                //
+                // A WATCHED PAGE IS READ AS NORMAL, WITH THE WATCHPOINTS CONSULTED ONCE THE VALUE IS KNOWN
+                template<typename T>
+                NOODLE_NO_INLINE T READ_SLOW(U32 ADDRESS, PAGE_ENTRY ENTRY, U8 ACCESS = watch::READ) const
+                {
+                    const U32 OFFSET = ADDRESS & PAGE_MASK;
+                    const bool FITS = OFFSET <= PAGE_SIZE - sizeof(T);
+                    T VALUE = 0;
+
+                    // A DEVICE SEES THE WHOLE ACCESS EVEN WHEN IT RUNS OFF THE END OF IT'S PAGE,
+                    // WHEREAS A SPLIT PAGE ONLY EVER DISPATCHES WHAT LIES WITHIN IT
+                    if((ENTRY & PAGE_MMIO) && (FITS || !IS_SPLIT(PAGE_RECORD(ENTRY))))
+                    {
+                        if(const MEMORY_HANDLERS* RECORD = PAGE_RECORD(ENTRY))
+                        {
+                            if constexpr (sizeof(T) == 1) VALUE = RECORD->READ_8 ? RECORD->READ_8(ADDRESS, RECORD->CTX) : 0;
+                            if constexpr (sizeof(T) == 2) VALUE = RECORD->READ_16 ? RECORD->READ_16(ADDRESS, RECORD->CTX) : 0;
+                            if constexpr (sizeof(T) == 4) VALUE = RECORD->READ_32 ? RECORD->READ_32(ADDRESS, RECORD->CTX) : 0;
+                        }
+                    }
+                    else if(FITS)
+                    {
+                        std::memcpy(&VALUE, PAGE_HOST(ENTRY) + OFFSET, sizeof(T));
+                        VALUE = ENDIAN::CONVERT(VALUE);
+                    }
+                    else
+                    {
+                        U8 BYTES[sizeof(T)];
+                        for(U32 INDEX = 0; INDEX < sizeof(T); INDEX++)
+                            BYTES[INDEX] = PEEK(ADDRESS + INDEX);
+
+                        std::memcpy(&VALUE, BYTES, sizeof(T));
+                        VALUE = ENDIAN::CONVERT(VALUE);
+
+                        // THE SECOND PAGE MAY BE WATCHED WHEN THE FIRST ISN'T
+                        ENTRY |= PAGES[((ADDRESS + sizeof(T) - 1) & ADDRESS_MASK) >> PAGE_BITS];
+                    }
+
+                    if(ENTRY & PAGE_TRAP_READ)
+                        NOTIFY(ADDRESS, sizeof(T), VALUE, ACCESS);
+
+                    return VALUE;
+                }
+
+                // SLOW PATH FOR WRITES
+                // WRITES TO A PAGE WITHOUT WRITE ACCESS ARE DROPPED, MUCH LIKE A WRITE TO ROM
+                // A WATCHPOINT STILL SEES A DROPPED WRITE, AS THE ACCESS WAS STILL MADE
+                template<typename T>
+                NOODLE_NO_INLINE void WRITE_SLOW(U32 ADDRESS, T VALUE, PAGE_ENTRY ENTRY)
+                {
+                    const U32 OFFSET = ADDRESS & PAGE_MASK;
+                    const bool FITS = OFFSET <= PAGE_SIZE - sizeof(T);
+
+                    if((ENTRY & PAGE_MMIO) && (FITS || !IS_SPLIT(PAGE_RECORD(ENTRY))))
+                    {
+                        if(const MEMORY_HANDLERS* RECORD = PAGE_RECORD(ENTRY))
+                        {
+                            if constexpr (sizeof(T) == 1) { if(RECORD->WRITE_8) RECORD->WRITE_8(ADDRESS, VALUE, RECORD->CTX); }
+                            if constexpr (sizeof(T) == 2) { if(RECORD->WRITE_16) RECORD->WRITE_16(ADDRESS, VALUE, RECORD->CTX); }
+                            if constexpr (sizeof(T) == 4) { if(RECORD->WRITE_32) RECORD->WRITE_32(ADDRESS, VALUE, RECORD->CTX); }
+                        }
+                    }
+                    else if(FITS)
+                    {
+                        // A TRACKED PAGE RECORDS IT'S PRE-IMAGE, THEN THE STORE GOES AHEAD AS NORMAL
+                        if(ENTRY & PAGE_WRITEABLE)
+                        {
+                            if(ENTRY & PAGE_TRACKED)
+                                TRACK(ADDRESS, sizeof(T), ENTRY);
+
+                            const T STORED = ENDIAN::CONVERT(VALUE);
+                            std::memcpy(PAGE_HOST(ENTRY) + OFFSET, &STORED, sizeof(T));
+                        }
+                    }
+                    else
+                    {
+                        U8 BYTES[sizeof(T)];
+                        const T STORED = ENDIAN::CONVERT(VALUE);
+                        std::memcpy(BYTES, &STORED, sizeof(T));
+
+                        for(U32 INDEX = 0; INDEX < sizeof(T); INDEX++)
+                            POKE(ADDRESS + INDEX, BYTES[INDEX]);
+
+                        ENTRY |= PAGES[((ADDRESS + sizeof(T) - 1) & ADDRESS_MASK) >> PAGE_BITS];
+                    }
+
+                    if(ENTRY & PAGE_TRAP_WRITE)
+                        NOTIFY(ADDRESS, sizeof(T), VALUE, watch::WRITE);
+                }
+
+                // SINGLE BYTE ACCESSES WHICH BYPASS THE WATCHPOINTS, FOR COMPOSING ACCESSES WHICH STRADDLE TWO PAGES
+                // THE COMPOSED ACCESS IS REPORTED ONCE AS A WHOLE, RATHER THAN ONCE PER BYTE
+                U8 PEEK(U32 ADDRESS) const
+                {
+                    const U32 MASKED = ADDRESS & ADDRESS_MASK;
+                    const PAGE_ENTRY ENTRY = PAGES[MASKED >> PAGE_BITS];
+
+                    if(!(ENTRY & PAGE_MMIO))
+                        return PAGE_HOST(ENTRY)[MASKED & PAGE_MASK];
+
+                    const MEMORY_HANDLERS* RECORD = PAGE_RECORD(ENTRY);
+                    return (RECORD && RECORD->READ_8) ? RECORD->READ_8(MASKED, RECORD->CTX) : 0;
+                }
+
+                void POKE(U32 ADDRESS, U8 VALUE)
+                {
+                    const U32 MASKED = ADDRESS & ADDRESS_MASK;
+                    const PAGE_ENTRY ENTRY = PAGES[MASKED >> PAGE_BITS];
+
+                    if(ENTRY & PAGE_MMIO)
+                    {
+                        const MEMORY_HANDLERS* RECORD = PAGE_RECORD(ENTRY);
+                        if(RECORD && RECORD->WRITE_8) RECORD->WRITE_8(MASKED, VALUE, RECORD->CTX);
+                        return;
+                    }
+
+                    if(!(ENTRY & PAGE_WRITEABLE))
+                        return;
+
+                    if(ENTRY & PAGE_TRACKED)
+                        TRACK(MASKED, 1, ENTRY);
+
+                    PAGE_HOST(ENTRY)[MASKED & PAGE_MASK] = VALUE;
+                }
+
+                // MAP THE CORRESPONDING ELEMENTS 
+                // FOR THE ASSIGNMENT OF THE VALUES THEMSELVES, WE WILL PRESUPPOSE
+                // THAT IT WILL CARRY OUT THE TYPE CONVERSIONS BASED ON THE ARGS PROVIDED
+                //
+                // USING MY HANDLER_ASSIGN TEMPLATE ALLOWS FOR A SIMPLE MEANS OF DISCERNING THE BYTEWISE LENGTH
+                // OF EACH OPERATIONS AND BEING ABLE TO DYNAMICALLY ALLOCATE
+
+                // HOW MANY BYTES FROM ADDRESS CAN BE HANDLED AS ONE PIECE
+                // DIRECT PAGES EXTEND THE RUN FOR AS LONG AS THE NEXT PAGE CARRIES THE SAME FLAGS AND CONTINUES
+                // THE HOST MEMORY OF THE LAST - ANYTHING ELSE STOPS AT THE END OF THE PAGE
+                std::size_t RUN_LENGTH(U32 ADDRESS, std::size_t LENGTH, PAGE_ENTRY ENTRY, bool DIRECT) const
+                {
+                    std::size_t RUN = std::min<std::size_t>(LENGTH, PAGE_SIZE - (ADDRESS & PAGE_MASK));
+                    if(!DIRECT) return RUN;
+
+                    PAGE_ENTRY EXPECTED = ENTRY + PAGE_SIZE;
+                    U32 NEXT = (ADDRESS & ~PAGE_MASK) + PAGE_SIZE;
+
+                    while(RUN < LENGTH && (NEXT & ADDRESS_MASK) != 0 && PAGES[NEXT >> PAGE_BITS] == EXPECTED)
+                    {
+                        RUN = std::min<std::size_t>(LENGTH, RUN + PAGE_SIZE);
+                        EXPECTED += PAGE_SIZE;
+                        NEXT += PAGE_SIZE;
+                    }
+
+                    return RUN;
+                }
+
+                // THE WIDEST ACCESS A BLOCK TRANSFER CAN MAKE AT ADDRESS ON A PAGE WHICH ISN'T DIRECT
+                // A DEVICE ONLY ANSWERS THE WIDTHS IT HAS HANDLERS FOR, SO AN ALIGNED RUN OVER A 16-BIT DEVICE MOVES A U16
+                // AT A TIME, WITH SINGLE BYTES LEFT FOR AN UNALIGNED HEAD OR TAIL - ON A SPLIT PAGE IT IS THE HANDLERS
+                // OF THE REGION BENEATH ADDRESS WHICH COUNT, AND ANYTHING BUT A DEVICE IS STILL MOVED BYTE BY BYTE
+                U32 BLOCK_WIDTH(U32 ADDRESS, std::size_t LEFT, PAGE_ENTRY ENTRY, bool WRITE) const
+                {
+                    const MEMORY_HANDLERS* RECORD = (ENTRY & PAGE_MMIO) ? PAGE_RECORD(ENTRY) : nullptr;
+
+                    if(IS_SPLIT(RECORD))
+                    {
+                        const SPLIT_PAGE& PAGE = *static_cast<const SPLIT_PAGE*>(RECORD->CTX);
+                        RECORD = PAGE.REGIONS[PAGE.LINES[(ADDRESS & PAGE_MASK) >> SPLIT_BITS]].RECORD;
+                    }
+
+                    if(RECORD == nullptr)
+                        return 1;
+
+                    if(LEFT >= 4 && (ADDRESS & 3) == 0 && (WRITE ? RECORD->WRITE_32 != nullptr : RECORD->READ_32 != nullptr))
+                        return 4;
+
+                    if(LEFT >= 2 && (ADDRESS & 1) == 0 && (WRITE ? RECORD->WRITE_16 != nullptr : RECORD->READ_16 != nullptr))
+                        return 2;
+
+                    return 1;
+                }
+
+                // MOVE ONE ACCESS OF A SLOW RUN, HOLDING IT'S BYTES IN GUEST ORDER JUST AS RAM WOULD
+                template<typename T>
+                void READ_PIECE(U32 ADDRESS, U8* DST, PAGE_ENTRY ENTRY) const
+                {
+                    const T VALUE = ENDIAN::CONVERT(READ_SLOW<T>(ADDRESS, ENTRY));
+                    std::memcpy(DST, &VALUE, sizeof(T));
+                }
+
+                template<typename T>
+                void WRITE_PIECE(U32 ADDRESS, const U8* SRC, PAGE_ENTRY ENTRY)
+                {
+                    T VALUE;
+                    std::memcpy(&VALUE, SRC, sizeof(T));
+                    WRITE_SLOW<T>(ADDRESS, ENDIAN::CONVERT(VALUE), ENTRY);
+                }
+
+                // A RUN WITHIN ONE PAGE WHICH ISN'T DIRECT, IN THE WIDEST PIECES EACH ADDRESS ALLOWS
+                // A REPEATED SOURCE (FOR A FILL) IS A SINGLE BYTE COPIED ACROSS A WORD, AND NEVER ADVANCES
+                void READ_RUN(U32 ADDRESS, U8* DST, std::size_t RUN, PAGE_ENTRY ENTRY) const
+                {
+                    for(std::size_t DONE = 0; DONE < RUN;)
+                    {
+                        const U32 AT = ADDRESS + static_cast<U32>(DONE);
+                        const U32 WIDTH = BLOCK_WIDTH(AT, RUN - DONE, ENTRY, false);
+
+                        if(WIDTH == 4) READ_PIECE<U32>(AT, DST + DONE, ENTRY);
+                        else if(WIDTH == 2) READ_PIECE<U16>(AT, DST + DONE, ENTRY);
+                        else READ_PIECE<U8>(AT, DST + DONE, ENTRY);
+
+                        DONE += WIDTH;
+                    }
+                }
+
+                void WRITE_RUN(U32 ADDRESS, const U8* SRC, std::size_t RUN, PAGE_ENTRY ENTRY, bool REPEAT = false)
+                {
+                    for(std::size_t DONE = 0; DONE < RUN;)
+                    {
+                        const U32 AT = ADDRESS + static_cast<U32>(DONE);
+                        const U32 WIDTH = BLOCK_WIDTH(AT, RUN - DONE, ENTRY, true);
+                        const U8* FROM = REPEAT ? SRC : SRC + DONE;
+
+                        if(WIDTH == 4) WRITE_PIECE<U32>(AT, FROM, ENTRY);
+                        else if(WIDTH == 2) WRITE_PIECE<U16>(AT, FROM, ENTRY);
+                        else WRITE_PIECE<U8>(AT, FROM, ENTRY);
+
+                        DONE += WIDTH;
+                    }
+                }
+
+                // SIZE OF THE BOUNCE BUFFER FOR COPIES WHICH CAN'T BE DONE HOST TO HOST
+                static constexpr std::size_t COPY_STAGE = 256;
+
+                // EVERYTHING THE BUS ALLOCATES ON BEHALF OF IT'S PAGES (HANDLER RECORDS, SPLIT PAGES AND FILE MAPPINGS),
+                // KEYED BY WHERE IT BEGINS IN HOST MEMORY AND ONLY EVER TOUCHED BY A MAP OR UNMAP - NEVER BY AN ACCESS
+                //
+                // EACH COUNTS THE PAGES STILL REFERRING TO IT, AND ONCE THAT FALLS TO ZERO IS RETIRED THROUGH THE TABLE EDIT -
+                // FREED THERE AND THEN ON A PRIVATE BUS, OR ONCE EVERY READER HAS MOVED PAST IT ON A SHARED ONE.
+                // A SPLIT PAGE IN TURN HOLDS WHATEVER IT'S REGIONS REFER TO, LETTING GO OF THEM AS IT IS RETIRED
+                struct OWNED
+                {
+                    std::uintptr_t END;
+                    std::size_t USES;
+                    std::shared_ptr<void> OBJECT;
+                    std::vector<std::uintptr_t> HOLDS;
+                };
+
+                using OWNED_MAP = std::map<std::uintptr_t, OWNED>;
+                OWNED_MAP OWNERSHIP;
+
+                // WHICHEVER OWNED OBJECT A HOST ADDRESS LIES WITHIN, IF ANY
+                typename OWNED_MAP::iterator OWNER_OF(std::uintptr_t ADDRESS)
+                {
+                    auto OWNER = OWNERSHIP.upper_bound(ADDRESS);
+                    if(OWNER == OWNERSHIP.begin()) return OWNERSHIP.end();
+
+                    --OWNER;
+                    return ADDRESS < OWNER->second.END ? OWNER : OWNERSHIP.end();
+                }
+
+                // TAKE OWNERSHIP OF AN OBJECT SPANNING SIZE BYTES FROM BEGIN, WITH A SINGLE USE HELD BY THE CALLER
+                // UNTIL IT HAS FINISHED MAPPING IT
+                void ADOPT(std::shared_ptr<void> OBJECT, const void* BEGIN, std::size_t SIZE, std::vector<std::uintptr_t> HOLDS = {})
+                {
+                    const std::uintptr_t FROM = reinterpret_cast<std::uintptr_t>(BEGIN);
+
+                    for(const std::uintptr_t HELD : HOLDS)
+                        ACQUIRE(HELD);
+
+                    OWNERSHIP.emplace(FROM, OWNED{ FROM + SIZE, 1, std::move(OBJECT), std::move(HOLDS) });
+                }
+
+                template<typename T>
+                T* ADOPT(std::unique_ptr<T> OBJECT, std::vector<std::uintptr_t> HOLDS = {})
+                {
+                    T* ADOPTED = OBJECT.get();
+                    ADOPT(std::shared_ptr<T>(std::move(OBJECT)), ADOPTED, sizeof(T), std::move(HOLDS));
+                    return ADOPTED;
+                }
+
+                // THE KEY OF WHICHEVER OWNED OBJECT HOST MEMORY BELONGS TO, OR ZERO
+                std::uintptr_t OWNER_KEY(const U8* HOST)
+                {
+                    if(OWNERSHIP.empty()) return 0;
+
+                    const auto OWNER = OWNER_OF(reinterpret_cast<std::uintptr_t>(HOST));
+                    return OWNER == OWNERSHIP.end() ? 0 : OWNER->first;
+                }
+
+                void ACQUIRE(std::uintptr_t ADDRESS)
+                {
+                    if(OWNERSHIP.empty()) return;
+
+                    const auto OWNER = OWNER_OF(ADDRESS);
+                    if(OWNER != OWNERSHIP.end()) OWNER->second.USES++;
+                }
+
+                template<typename TABLE_EDIT>
+                void RELEASE(TABLE_EDIT& TABLE, std::uintptr_t ADDRESS)
+                {
+                    if(OWNERSHIP.empty()) return;
+
+                    const auto OWNER = OWNER_OF(ADDRESS);
+                    if(OWNER == OWNERSHIP.end() || --OWNER->second.USES > 0) return;
+
+                    // AN UNDO RECORD MUST NEVER WRITE BACK INTO MEMORY THAT IS ABOUT TO BE FREED
+                    if(TRACKER)
+                        TRACKER->FORGET(OWNER->first);
+
+                    const std::vector<std::uintptr_t> HOLDS = std::move(OWNER->second.HOLDS);
+                    TABLE.RETIRE(std::move(OWNER->second.OBJECT));
+                    OWNERSHIP.erase(OWNER);
+
+                    for(const std::uintptr_t HELD : HOLDS)
+                        RELEASE(TABLE, HELD);
+                }
+
+                // POINT A PAGE AT SOMETHING ELSE, MOVING IT'S USE FROM WHATEVER IT REFERRED TO BEFORE
+                template<typename TABLE_EDIT>
+                void REPOINT(TABLE_EDIT& TABLE, U32 INDEX, PAGE_ENTRY ENTRY)
+                {
+                    const PAGE_ENTRY OLD = TABLE[INDEX];
+
+                    ACQUIRE(ENTRY & ~PAGE_FLAG_MASK);
+                    TABLE.SET(INDEX, ENTRY);
+                    RELEASE(TABLE, OLD & ~PAGE_FLAG_MASK);
+                }
+
+                // SPLIT PAGES - A PAGE SHARED BETWEEN RAM AND DEVICE REGISTERS, OR BETWEEN SEVERAL DEVICES
+                // A SPLIT PAGE IS AN ORDINARY MMIO PAGE WHOSE HANDLER RECORD DISPATCHES THROUGH A SECOND-LEVEL TABLE:
+                // ONE REGION INDEX PER SPLIT_SIZE LINE OF THE PAGE, SO FINDING THE REGION IS A SINGLE LOAD
+                //
+                // RAM REGIONS ARE THEN A LOAD OR STORE THROUGH THE REGION'S HOST ADDEND, WHILST DEVICE REGIONS
+                // CALL THROUGH THEIR OWN HANDLER RECORD - ANY OTHER PAGE NEVER SEES ANY OF THIS
+                static constexpr U32 SPLIT_BITS = 4;
+                static constexpr U32 SPLIT_SIZE = 1U << SPLIT_BITS;
+                static constexpr U32 SPLIT_MASK = SPLIT_SIZE - 1;
+                static constexpr U32 SPLIT_LINES = PAGE_SIZE >> SPLIT_BITS;
+                static constexpr U32 SPLIT_REGIONS = 256;
+
+                // HELD IS WHATEVER OWNED OBJECT THE REGION KEEPS ALIVE - IT'S RECORD, OR THE MAPPING BEHIND A RAM BACKGROUND
+                struct SPLIT_REGION
+                {
+                    std::uintptr_t ADDEND = 0;
+                    const MEMORY_HANDLERS* RECORD = nullptr;
+                    bool DIRECT = false;
+                    bool WRITEABLE = false;
+                    std::uintptr_t HELD = 0;
+                };
+
+                // THE DISPATCH RECORD COMES FIRST, SO THE PAGE ENTRY CAN POINT STRAIGHT AT THE SPLIT PAGE
+                // THE BUS IS ONLY THERE FOR THE DIRTY TRACKER, WHICH A SPLIT PAGE'S RAM REPORTS IT'S WRITES TO
+                struct SPLIT_PAGE
+                {
+                    MEMORY_HANDLERS DISPATCH;
+                    std::vector<SPLIT_REGION> REGIONS;
+                    std::array<U8, SPLIT_LINES> LINES;
+                    BASIC_MEMORY_BUS* BUS = nullptr;
+                };
+
+                // SPLIT PAGES ARE NEVER EDITED ONCE PUBLISHED - EACH CHANGE BUILDS A NEW ONE, AND THE ONE IT REPLACES
+                // IS RETIRED LIKE ANY OTHER OWNED OBJECT, SO A READER STILL DISPATCHING THROUGH IT IS SAFE
+
+                static NOODLE_FORCE_INLINE bool IS_SPLIT(const MEMORY_HANDLERS* RECORD)
+                {
+                    return RECORD != nullptr && RECORD->READ_8 == &SPLIT_READ<U8>;
+                }
+
+                // THE HOST MEMORY BEHIND AN ACCESS TO RAM WITHIN A SPLIT PAGE, OR NULL IF IT MUST GO THROUGH THE SLOW PATH
+                // ONLY AN ACCESS WITHIN ONE LINE OF AN UNWATCHED PAGE QUALIFIES, AS IT CAN THEN ONLY EVER LAND IN ONE REGION -
+                // WHICH MUST BE RAM, AND FOR A WRITE BOTH WRITEABLE AND UNTRACKED
+                //
+                // THIS LETS READ AND WRITE SKIP THE CALL INTO THE SLOW PATH AND THROUGH THE SPLIT'S DISPATCH RECORD
+                template<typename T, bool WRITE>
+                NOODLE_FORCE_INLINE U8* SPLIT_HOST(U32 ADDRESS, PAGE_ENTRY ENTRY) const
+                {
+                    constexpr PAGE_ENTRY TRAP = WRITE ? PAGE_TRAP_WRITE : PAGE_TRAP_READ;
+
+                    if((ENTRY & (PAGE_MMIO | TRAP)) != PAGE_MMIO || (ADDRESS & SPLIT_MASK) > SPLIT_SIZE - sizeof(T))
+                        return nullptr;
+
+                    const MEMORY_HANDLERS* RECORD = PAGE_RECORD(ENTRY);
+                    if(!IS_SPLIT(RECORD)) return nullptr;
+
+                    const SPLIT_PAGE& PAGE = *reinterpret_cast<const SPLIT_PAGE*>(RECORD);
+                    const U32 OFFSET = ADDRESS & PAGE_MASK;
+                    const SPLIT_REGION& REGION = PAGE.REGIONS[PAGE.LINES[OFFSET >> SPLIT_BITS]];
+
+                    if(!REGION.DIRECT) return nullptr;
+                    if(WRITE && (!REGION.WRITEABLE || TRACKER)) return nullptr;
+
+                    return reinterpret_cast<U8*>(REGION.ADDEND + OFFSET);
+                }
+
+                template<typename T>
+                static T SPLIT_READ(U32 ADDRESS, void* CTX)
+                {
+                    const SPLIT_PAGE& PAGE = *static_cast<const SPLIT_PAGE*>(CTX);
+                    const U32 OFFSET = ADDRESS & PAGE_MASK;
+                    const U8 INDEX = PAGE.LINES[OFFSET >> SPLIT_BITS];
+
+                    // AN ACCESS RUNNING INTO THE NEXT REGION IS COMPOSED A BYTE AT A TIME
+                    if constexpr (sizeof(T) > 1)
+                    {
+                        if(NOODLE_UNLIKELY(PAGE.LINES[(OFFSET + sizeof(T) - 1) >> SPLIT_BITS] != INDEX))
+                        {
+                            U8 BYTES[sizeof(T)];
+                            for(U32 BYTE = 0; BYTE < sizeof(T); BYTE++)
+                                BYTES[BYTE] = SPLIT_READ<U8>(ADDRESS + BYTE, CTX);
+
+                            T VALUE;
+                            std::memcpy(&VALUE, BYTES, sizeof(T));
+                            return ENDIAN::CONVERT(VALUE);
+                        }
+                    }
+
+                    const SPLIT_REGION& REGION = PAGE.REGIONS[INDEX];
+
+                    if(REGION.DIRECT)
+                    {
+                        T VALUE;
+                        std::memcpy(&VALUE, reinterpret_cast<const U8*>(REGION.ADDEND + OFFSET), sizeof(T));
+                        return ENDIAN::CONVERT(VALUE);
+                    }
+
+                    const MEMORY_HANDLERS* RECORD = REGION.RECORD;
+                    if(RECORD == nullptr) return 0;
+
+                    if constexpr (sizeof(T) == 1) return RECORD->READ_8 ? RECORD->READ_8(ADDRESS, RECORD->CTX) : 0;
+                    if constexpr (sizeof(T) == 2) return RECORD->READ_16 ? RECORD->READ_16(ADDRESS, RECORD->CTX) : 0;
+                    if constexpr (sizeof(T) == 4) return RECORD->READ_32 ? RECORD->READ_32(ADDRESS, RECORD->CTX) : 0;
+                }
+
+                template<typename T>
+                static void SPLIT_WRITE(U32 ADDRESS, T VALUE, void* CTX)
+                {
+                    const SPLIT_PAGE& PAGE = *static_cast<const SPLIT_PAGE*>(CTX);
+                    const U32 OFFSET = ADDRESS & PAGE_MASK;
+                    const U8 INDEX = PAGE.LINES[OFFSET >> SPLIT_BITS];
+
+                    if constexpr (sizeof(T) > 1)
+                    {
+                        if(NOODLE_UNLIKELY(PAGE.LINES[(OFFSET + sizeof(T) - 1) >> SPLIT_BITS] != INDEX))
+                        {
+                            U8 BYTES[sizeof(T)];
+                            VALUE = ENDIAN::CONVERT(VALUE);
+                            std::memcpy(BYTES, &VALUE, sizeof(T));
+
+                            for(U32 BYTE = 0; BYTE < sizeof(T); BYTE++)
+                                SPLIT_WRITE<U8>(ADDRESS + BYTE, BYTES[BYTE], CTX);
+
+                            return;
+                        }
+                    }
+
+                    const SPLIT_REGION& REGION = PAGE.REGIONS[INDEX];
+
+                    if(REGION.DIRECT)
+                    {
+                        if(!REGION.WRITEABLE) return;
+
+                        if(PAGE.BUS->TRACKER)
+                            PAGE.BUS->TRACK_LINES(ADDRESS, sizeof(T), REGION.ADDEND);
+
+                        VALUE = ENDIAN::CONVERT(VALUE);
+                        std::memcpy(reinterpret_cast<U8*>(REGION.ADDEND + OFFSET), &VALUE, sizeof(T));
+                        return;
+                    }
+
+                    const MEMORY_HANDLERS* RECORD = REGION.RECORD;
+                    if(RECORD == nullptr) return;
+
+                    if constexpr (sizeof(T) == 1) { if(RECORD->WRITE_8) RECORD->WRITE_8(ADDRESS, VALUE, RECORD->CTX); }
+                    if constexpr (sizeof(T) == 2) { if(RECORD->WRITE_16) RECORD->WRITE_16(ADDRESS, VALUE, RECORD->CTX); }
+                    if constexpr (sizeof(T) == 4) { if(RECORD->WRITE_32) RECORD->WRITE_32(ADDRESS, VALUE, RECORD->CTX); }
+                }
+
+                // DOES AN ACCESS OF SIZE BYTES TOUCH A PAGE WITH NOTHING MAPPED TO IT - A WATCHPOINT DOESN'T COUNT AS A MAPPING
+                NOODLE_FORCE_INLINE bool UNMAPPED(U32 MASKED, U32 SIZE) const
+                {
+                    const U32 LAST = (MASKED + SIZE - 1) & ADDRESS_MASK;
+                    const bool FIRST = (PAGES[MASKED >> PAGE_BITS] & ~PAGE_TRAPS) == PAGE_UNMAPPED;
+
+                    // THE SECOND PAGE IS ONLY LOOKED UP BY AN ACCESS WHICH CROSSES INTO IT
+                    if(NOODLE_LIKELY(((MASKED ^ LAST) >> PAGE_BITS) == 0))
+                        return FIRST;
+
+                    return FIRST || (PAGES[LAST >> PAGE_BITS] & ~PAGE_TRAPS) == PAGE_UNMAPPED;
+                }
+
+                static NOODLE_NO_INLINE noodle::err::ERROR_VALUE BUS_FAULT(const char* ACCESS, U32 ADDRESS)
+                {
+                    return MAKE_ERROR(ERROR_CATEGORY::OOB, FMT_STRING("BUS: {} OF UNMAPPED ADDRESS 0x{:08X}"), ACCESS, ADDRESS).WITH_CODE(ADDRESS);
+                }
+
+                // EVERY MAPPING MUST LIE WITHIN THE ADDRESS SPACE - ANYTHING PAST IT WOULD INDEX BEYOND THE PAGE TABLE
+                static RESULT<void> IN_RANGE(const char* CALLER, U32 START, U32 END)
+                {
+                    if(START <= END && END <= ADDRESS_MASK)
+                        return noodle::err::SUCCESS();
+
+                    return MAKE_ERROR(ERROR_CATEGORY::OOB, FMT_STRING("{}: 0x{:08X}-0x{:08X} IS NOT A RANGE WITHIN 0x00000000-0x{:08X}"),
+                                      CALLER, START, END, ADDRESS_MASK).WITH_CODE(START);
+                }
+
+                static RESULT<void> SPLIT_ALIGNED(const char* CALLER, U32 START, U32 END)
+                {
+                    NOODLE_TRY(IN_RANGE(CALLER, START, END));
+
+                    if((START & SPLIT_MASK) == 0 && ((END + 1) & SPLIT_MASK) == 0)
+                        return noodle::err::SUCCESS();
+
+                    return MAKE_ERROR(ERROR_CATEGORY::INVALID_ARG, FMT_STRING("{}: 0x{:08X}-0x{:08X} IS NOT ALIGNED TO {} BYTES"),
+                                      CALLER, START, END, SPLIT_SIZE).WITH_CODE(START);
+                }
+
+                // LAY A REGION OVER PART OF A PAGE, SPLITTING THE PAGE IF IT ISN'T ALREADY
+                // WHATEVER THE PAGE HELD BEFOREHAND BECOMES THE BACKGROUND FOR THE REST OF IT,
+                // AND REGIONS WHICH NO LONGER COVER ANY LINE ARE DROPPED
+                template<typename TABLE_EDIT>
+                RESULT<void> OVERLAY(TABLE_EDIT& TABLE, U32 PAGE, U32 FIRST, U32 LAST, const SPLIT_REGION& REGION)
+                {
+                    const PAGE_ENTRY OLD = TABLE[PAGE];
+                    const MEMORY_HANDLERS* OLD_RECORD = (OLD & PAGE_MMIO) ? PAGE_RECORD(OLD) : nullptr;
+
+                    auto SPLIT = std::make_unique<SPLIT_PAGE>();
+                    SPLIT->BUS = this;
+                    std::vector<SPLIT_REGION> REGIONS;
+                    std::array<U16, SPLIT_LINES> LINES;
+
+                    if(IS_SPLIT(OLD_RECORD))
+                    {
+                        const SPLIT_PAGE& PREVIOUS = *static_cast<const SPLIT_PAGE*>(OLD_RECORD->CTX);
+                        REGIONS = PREVIOUS.REGIONS;
+                        std::copy(PREVIOUS.LINES.begin(), PREVIOUS.LINES.end(), LINES.begin());
+                    }
+                    else
+                    {
+                        SPLIT_REGION BACKGROUND;
+
+                        if(!(OLD & PAGE_MMIO))
+                        {
+                            BACKGROUND.ADDEND = reinterpret_cast<std::uintptr_t>(PAGE_HOST(OLD));
+                            BACKGROUND.DIRECT = true;
+                            BACKGROUND.WRITEABLE = (OLD & PAGE_WRITEABLE) != 0;
+                        }
+                        else
+                            BACKGROUND.RECORD = OLD_RECORD;
+
+                        BACKGROUND.HELD = OLD & ~PAGE_FLAG_MASK;
+
+                        REGIONS.push_back(BACKGROUND);
+                        LINES.fill(0);
+                    }
+
+                    REGIONS.push_back(REGION);
+                    std::fill(LINES.begin() + (FIRST >> SPLIT_BITS), LINES.begin() + (LAST >> SPLIT_BITS) + 1,
+                              static_cast<U16>(REGIONS.size() - 1));
+
+                    // COMPACT AWAY ANY REGION THE NEW ONE HAS COMPLETELY COVERED
+                    std::vector<U16> REMAP(REGIONS.size(), 0xFFFF);
+
+                    for(U32 LINE = 0; LINE < SPLIT_LINES; LINE++)
+                    {
+                        if(REMAP[LINES[LINE]] == 0xFFFF)
+                        {
+                            REMAP[LINES[LINE]] = static_cast<U16>(SPLIT->REGIONS.size());
+                            SPLIT->REGIONS.push_back(REGIONS[LINES[LINE]]);
+                        }
+
+                        SPLIT->LINES[LINE] = static_cast<U8>(REMAP[LINES[LINE]]);
+                    }
+
+                    if(SPLIT->REGIONS.size() > SPLIT_REGIONS)
+                        return MAKE_ERROR(ERROR_CATEGORY::RES_ERR, FMT_STRING("MAP: PAGE 0x{:X} CANNOT HOLD MORE THAN {} REGIONS"), PAGE, SPLIT_REGIONS);
+
+                    SPLIT->DISPATCH.CTX = SPLIT.get();
+                    SPLIT->DISPATCH.READ_8 = &SPLIT_READ<U8>;
+                    SPLIT->DISPATCH.READ_16 = &SPLIT_READ<U16>;
+                    SPLIT->DISPATCH.READ_32 = &SPLIT_READ<U32>;
+                    SPLIT->DISPATCH.WRITE_8 = &SPLIT_WRITE<U8>;
+                    SPLIT->DISPATCH.WRITE_16 = &SPLIT_WRITE<U16>;
+                    SPLIT->DISPATCH.WRITE_32 = &SPLIT_WRITE<U32>;
+
+                    // THE SPLIT HOLDS THE RECORD OR MAPPING BENEATH EACH OF IT'S REGIONS
+                    std::vector<std::uintptr_t> HOLDS;
+
+                    for(const SPLIT_REGION& KEPT : SPLIT->REGIONS)
+                        if(KEPT.HELD != 0) HOLDS.push_back(KEPT.HELD);
+
+                    const SPLIT_PAGE* ADOPTED = ADOPT(std::move(SPLIT), std::move(HOLDS));
+                    REPOINT(TABLE, PAGE, reinterpret_cast<PAGE_ENTRY>(&ADOPTED->DISPATCH) | PAGE_MMIO | (OLD & PAGE_TRAPS));
+                    RELEASE(TABLE, reinterpret_cast<std::uintptr_t>(ADOPTED));
+                    return noodle::err::SUCCESS();
+                }
+
+                // POINT A RANGE OF PAGES AT A HOST BUFFER, MIRRORING IT ACROSS THE RANGE
+                template<typename TABLE_EDIT>
+                void MAP_PAGES(TABLE_EDIT& TABLE, U32 START, U32 END, U8* BUFFER, std::size_t SIZE, bool WRITEABLE)
+                {
+                    const PAGE_ENTRY FLAGS = WRITEABLE ? (TRACKER ? PAGE_WRITEABLE | PAGE_TRACKED : PAGE_WRITEABLE) : PAGE_READONLY;
+                    std::size_t OFFSET = 0;
+
+                    for(U32 INDEX = START >> PAGE_BITS; INDEX <= (END >> PAGE_BITS); INDEX++)
+                    {
+                        REPOINT(TABLE, INDEX, reinterpret_cast<PAGE_ENTRY>(BUFFER + OFFSET) | FLAGS);
+                        OFFSET = (OFFSET + PAGE_SIZE) % SIZE;
+                    }
+
+                    if(!WATCHES.empty())
+                        RETRAP(TABLE, START >> PAGE_BITS, END >> PAGE_BITS);
+                }
+
+                // DIRTY TRACKING STATE - ONLY ALLOCATED WHILE TRACKING IS ENABLED
+                //
+                // THE ADDRESS SPACE IS DIVIDED INTO GRANULES OF 1 << GRANULE_BITS BYTES, WITH ONE BIT PER GRANULE
+                // SET BY THE FIRST WRITE TO IT SINCE THE LAST SNAPSHOT - AT WHICH POINT THE GRANULE'S PRE-IMAGE
+                // IS APPENDED TO AN UNDO LOG, BACKED BY A SINGLE ARENA WHICH IS REUSED RATHER THAN FREED
+                //
+                // EACH SNAPSHOT IS THEN NOTHING MORE THAN A POSITION IN THE LOG, AND ROLLING BACK TO IT
+                // REPLAYS THE PRE-IMAGES AFTER THAT POSITION IN REVERSE - SO BOTH SCALE WITH THE WORKING SET,
+                // RATHER THAN WITH HOW MUCH MEMORY IS MAPPED
+                struct DIRTY_TRACKER
+                {
+                    // OWNER IS THE OWNED OBJECT (A FILE MAPPING) THE HOST MEMORY BELONGS TO, OR ZERO FOR MEMORY THE CALLER OWNS
+                    struct UNDO_RECORD
+                    {
+                        U8* HOST;
+                        std::size_t OFFSET;
+                        std::size_t LENGTH;
+                        std::uintptr_t OWNER;
+                    };
+
+                    U32 GRANULE_BITS = PAGE_BITS;
+                    U32 BASE_ID = 0;
+
+                    std::vector<U64> GRANULES;
+                    std::vector<U64> DIRTY_MAP;
+                    std::vector<U32> DIRTY;
+
+                    // SPLIT_SIZE LINES OF SPLIT PAGE RAM CAPTURED THIS EPOCH, BY GUEST ADDRESS
+                    std::unordered_set<U32> LINES;
+
+                    std::vector<UNDO_RECORD> LOG;
+                    std::vector<U8> ARENA;
+                    std::vector<std::size_t> EPOCHS;
+
+                    static bool TEST(const std::vector<U64>& BITS, std::size_t INDEX)
+                    {
+                        return (BITS[INDEX >> 6] >> (INDEX & 63)) & 1;
+                    }
+
+                    static void SET(std::vector<U64>& BITS, std::size_t INDEX)
+                    {
+                        BITS[INDEX >> 6] |= 1ULL << (INDEX & 63);
+                    }
+
+                    // THE PARTIAL WORDS AT EITHER END ARE CLEARED BIT BY BIT,
+                    // WITH THE WHOLE WORDS IN BETWEEN BEING A SINGLE (VECTORISED) FILL
+                    static void CLEAR(std::vector<U64>& BITS, std::size_t FIRST, std::size_t COUNT)
+                    {
+                        for(; COUNT > 0 && (FIRST & 63) != 0; FIRST++, COUNT--)
+                            BITS[FIRST >> 6] &= ~(1ULL << (FIRST & 63));
+
+                        std::fill_n(BITS.begin() + (FIRST >> 6), COUNT >> 6, 0);
+                        FIRST += COUNT & ~static_cast<std::size_t>(63);
+
+                        for(COUNT &= 63; COUNT > 0; FIRST++, COUNT--)
+                            BITS[FIRST >> 6] &= ~(1ULL << (FIRST & 63));
+                    }
+
+                    // APPEND A PRE-IMAGE, EXTENDING THE PREVIOUS RECORD WHEN IT ENDS WHERE THIS ONE BEGINS WITHIN THE SAME OWNER
+                    // NOTHING IS KEPT UNTIL THERE IS A SNAPSHOT TO ROLL BACK TO
+                    void CAPTURE(U8* HOST, std::size_t LENGTH, std::uintptr_t OWNER)
+                    {
+                        if(EPOCHS.empty())
+                            return;
+
+                        const std::size_t OFFSET = ARENA.size();
+                        ARENA.insert(ARENA.end(), HOST, HOST + LENGTH);
+
+                        if(LOG.size() > EPOCHS.back() && LOG.back().HOST + LOG.back().LENGTH == HOST && LOG.back().OWNER == OWNER)
+                            LOG.back().LENGTH += LENGTH;
+                        else
+                            LOG.push_back(UNDO_RECORD{ HOST, OFFSET, LENGTH, OWNER });
+                    }
+
+                    // DROP EVERY PRE-IMAGE OF AN OWNED OBJECT AS IT IS RETIRED - THE RECORDS STAY IN PLACE, SO THE EPOCHS
+                    // AND ARENA OFFSETS STILL HOLD, BUT ARE EMPTIED AND NEVER WRITTEN BACK
+                    void FORGET(std::uintptr_t OWNER)
+                    {
+                        for(UNDO_RECORD& RECORD : LOG)
+                        {
+                            if(RECORD.OWNER == OWNER)
+                                RECORD = UNDO_RECORD{ nullptr, RECORD.OFFSET, 0, 0 };
+                        }
+                    }
+                };
+
+                std::unique_ptr<DIRTY_TRACKER> TRACKER;
+
+                #if NOODLE_BUS_PROFILE
+                    // PER-PAGE ACCESS COUNTERS AND THE OPTIONAL TRACE RING
+                    // THE COUNTERS ARE BUMPED WITH A RELAXED LOAD AND STORE RATHER THAN AN ATOMIC ADD - ON A SHARED BUS
+                    // A RACING INCREMENT MAY BE LOST, WHICH IS AN ACCEPTABLE ERROR FOR A HEATMAP AND KEEPS EACH ONE A PLAIN ADD
+                    //
+                    // THE RING CLAIMS EACH SLOT THROUGH THE SYNC COUNTER, SO CONCURRENT ACCESSES NEVER SHARE A SLOT,
+                    // AND OVERWRITES IT'S OLDEST RECORDS ONCE FULL
+                    struct BUS_PROFILE
+                    {
+                        std::unique_ptr<std::atomic<U64>[]> COUNTS;
+                        std::unique_ptr<FUJIKO_TRACE_RECORD[]> RING;
+                        U32 RING_MASK = 0;
+                        typename SYNC::COUNTER HEAD{0};
+
+                        template<typename T>
+                        NOODLE_FORCE_INLINE void RECORD(U32 ADDRESS, T VALUE, U8 ACCESS)
+                        {
+                            std::atomic<U64>& COUNT = COUNTS[(ADDRESS >> PAGE_BITS) * 6
+                                                             + (ACCESS == watch::WRITE ? 3 : 0) + (sizeof(T) >> 1)];
+
+                            COUNT.store(COUNT.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+                            if(RING)
+                                RING[HEAD++ & RING_MASK] = FUJIKO_TRACE_RECORD{ ADDRESS, VALUE, sizeof(T), ACCESS };
+                        }
+                    };
+
+                    // ACCESSES ON A SHARED BUS MAY STILL BE RECORDING INTO A PROFILE AS IT IS REPLACED, SO IT IS PUBLISHED
+                    // THROUGH AN ATOMIC POINTER AND THE ONE IT REPLACES IS RETIRED THROUGH A TABLE EDIT, LIKE A HANDLER RECORD
+                    std::atomic<BUS_PROFILE*> PROFILER{nullptr};
+                    std::shared_ptr<BUS_PROFILE> PROFILE_OWNED;
+
+                    void PUBLISH_PROFILE(std::shared_ptr<BUS_PROFILE> NEXT)
+                    {
+                        auto&& TABLE = PAGES.EDIT();
+
+                        PROFILER.store(NEXT.get(), std::memory_order_release);
+                        std::swap(PROFILE_OWNED, NEXT);
+
+                        if(NEXT)
+                            TABLE.RETIRE(std::move(NEXT));
+                    }
+                #endif
+
+                // PASS AN ACCESS THROUGH THE PROFILER, WHEN ONE IS BUILT IN AND RUNNING
+                template<typename T>
+                NOODLE_FORCE_INLINE T PROFILED(U32 ADDRESS, T VALUE, U8 ACCESS) const
+                {
+                    #if NOODLE_BUS_PROFILE
+                        if(BUS_PROFILE* PROFILE = PROFILER.load(std::memory_order_acquire); NOODLE_UNLIKELY(PROFILE != nullptr))
+                            PROFILE->RECORD(ADDRESS, VALUE, ACCESS);
+                    #endif
+
+                    return VALUE;
+                }
+
+                // WATCHPOINTS, KEPT SORTED BY THEIR START ADDRESS
+                // REACH IS A MAX TREE OVER THEIR ENDS - LEAF I (AT REACH_LEAVES + I) HOLDS THE END OF RANGE I, AND EACH NODE
+                // ABOVE THE FURTHEST END BENEATH IT. A LOOKUP IS A BINARY SEARCH FOR THE RANGES STARTING AT OR BEFORE THE ACCESS,
+                // THEN A DESCENT WHICH ONLY ENTERS SUBTREES REACHING THE ACCESS - SO IT COSTS LOG N PER RANGE FOUND,
+                // HOWEVER WIDE A RANGE SITS IN FRONT OF THE REST
+                struct WATCH_RANGE
+                {
+                    U32 START;
+                    U32 END;
+                    U32 ID;
+                    U8 ACCESS;
+                    FUJIKO_WATCH_CALLBACK CALLBACK;
+                    void* CTX;
+                };
+
+                std::vector<WATCH_RANGE> WATCHES;
+                std::vector<U32> REACH;
+                std::size_t REACH_LEAVES = 0;
+                U32 NEXT_WATCH = 0;
+
+                // CALL BACK EVERY WATCHPOINT OF THE RIGHT KIND OVERLAPPING THE ACCESS
+                NOODLE_NO_INLINE void NOTIFY(U32 ADDRESS, U32 SIZE, U32 VALUE, U8 ACCESS) const
+                {
+                    const U32 FIRST = ADDRESS & ADDRESS_MASK;
+                    const U32 LAST = FIRST + SIZE - 1;
+
+                    const auto UPPER = std::upper_bound(WATCHES.begin(), WATCHES.end(), LAST,
+                                        [](U32 KEY, const WATCH_RANGE& RANGE) { return KEY < RANGE.START; });
+
+                    const FUJIKO_WATCH_EVENT EVENT{ FIRST, SIZE, VALUE, ACCESS };
+
+                    REACHING(1, 0, REACH_LEAVES, static_cast<std::size_t>(UPPER - WATCHES.begin()), FIRST, [&](const WATCH_RANGE& RANGE)
+                    {
+                        if(RANGE.ACCESS & ACCESS)
+                            RANGE.CALLBACK(EVENT, RANGE.CTX);
+                    });
+                }
+
+                // WHICH TRAPS A PAGE NEEDS FROM THE WATCHPOINTS WHICH OVERLAP IT
+                PAGE_ENTRY WATCH_TRAPS(U32 INDEX) const
+                {
+                    const U32 FIRST = INDEX << PAGE_BITS;
+                    const U32 LAST = FIRST + PAGE_MASK;
+                    PAGE_ENTRY TRAPS = 0;
+
+                    const auto UPPER = std::upper_bound(WATCHES.begin(), WATCHES.end(), LAST,
+                                        [](U32 KEY, const WATCH_RANGE& RANGE) { return KEY < RANGE.START; });
+
+                    REACHING(1, 0, REACH_LEAVES, static_cast<std::size_t>(UPPER - WATCHES.begin()), FIRST, [&](const WATCH_RANGE& RANGE)
+                    {
+                        if(RANGE.ACCESS & (watch::READ | watch::EXECUTE)) TRAPS |= PAGE_TRAP_READ;
+                        if(RANGE.ACCESS & watch::WRITE) TRAPS |= PAGE_TRAP_WRITE;
+                    });
+
+                    return TRAPS;
+                }
+
+                // RECOMPUTE THE TRAPS OF A RANGE OF PAGES, AFTER A WATCHPOINT OR THE MAPPING BENEATH IT HAS CHANGED
+                template<typename TABLE_EDIT>
+                void RETRAP(TABLE_EDIT& TABLE, U32 START_INDEX, U32 END_INDEX)
+                {
+                    for(U32 INDEX = START_INDEX; INDEX <= END_INDEX; INDEX++)
+                    {
+                        const PAGE_ENTRY ENTRY = TABLE[INDEX];
+                        const PAGE_ENTRY UPDATED = (ENTRY & ~PAGE_TRAPS) | WATCH_TRAPS(INDEX);
+
+                        if(UPDATED != ENTRY)
+                            TABLE.SET(INDEX, UPDATED);
+                    }
+                }
+
+                // VISIT EVERY RANGE AMONG THE FIRST COUNT WHICH ENDS AT OR AFTER FIRST
+                // NODE COVERS THE RANGES FROM LOW UP TO (BUT NOT INCLUDING) HIGH
+                template<typename VISITOR>
+                void REACHING(std::size_t NODE, std::size_t LOW, std::size_t HIGH, std::size_t COUNT, U32 FIRST, VISITOR&& VISIT) const
+                {
+                    if(LOW >= COUNT || REACH[NODE] < FIRST)
+                        return;
+
+                    if(NODE >= REACH_LEAVES)
+                    {
+                        VISIT(WATCHES[LOW]);
+                        return;
+                    }
+
+                    const std::size_t MIDDLE = (LOW + HIGH) / 2;
+                    REACHING(NODE * 2, LOW, MIDDLE, COUNT, FIRST, VISIT);
+                    REACHING(NODE * 2 + 1, MIDDLE, HIGH, COUNT, FIRST, VISIT);
+                }
+
+                // REBUILD THE TREE AFTER A RANGE HAS BEEN ADDED OR REMOVED - THE INSERT OR ERASE WAS LINEAR ANYWAY
+                // LEAVES PAST THE LAST RANGE ARE NEVER VISITED, AS THE DESCENT STOPS AT COUNT
+                void REBUILD_REACH()
+                {
+                    REACH_LEAVES = 1;
+                    while(REACH_LEAVES < WATCHES.size()) REACH_LEAVES *= 2;
+
+                    REACH.assign(REACH_LEAVES * 2, 0);
+
+                    for(std::size_t INDEX = 0; INDEX < WATCHES.size(); INDEX++)
+                        REACH[REACH_LEAVES + INDEX] = WATCHES[INDEX].END;
+
+                    for(std::size_t NODE = REACH_LEAVES; NODE-- > 1;)
+                        REACH[NODE] = std::max(REACH[NODE * 2], REACH[NODE * 2 + 1]);
+                }
+
+                // MARK EVERY GRANULE A WRITE TOUCHES, CAPTURING THOSE WHICH ARE CLEAN
+                // AT PAGE GRANULARITY THE WHOLE PAGE HAS NOW BEEN CAPTURED, SO IT'S TRAP IS LIFTED
+                // AND THE REST OF THE EPOCH'S WRITES TO IT TAKE THE FAST PATH - FINER GRANULES KEEP THE TRAP SET
+                //
+                // ON A SHARED BUS THE TABLE EDIT ALSO SERIALISES TRACKED WRITES FROM EVERY THREAD
+                NOODLE_NO_INLINE void TRACK(U32 ADDRESS, std::size_t LENGTH, PAGE_ENTRY ENTRY)
+                {
+                    auto&& TABLE = PAGES.EDIT();
+                    DIRTY_TRACKER& STATE = *TRACKER;
+
+                    const U32 PAGE = ADDRESS >> PAGE_BITS;
+                    const U32 SHIFT = PAGE_BITS - STATE.GRANULE_BITS;
+                    const U32 FIRST = (ADDRESS & PAGE_MASK) >> STATE.GRANULE_BITS;
+                    const U32 LAST = static_cast<U32>(((ADDRESS & PAGE_MASK) + LENGTH - 1) >> STATE.GRANULE_BITS);
+
+                    if(!DIRTY_TRACKER::TEST(STATE.DIRTY_MAP, PAGE))
+                    {
+                        DIRTY_TRACKER::SET(STATE.DIRTY_MAP, PAGE);
+                        STATE.DIRTY.push_back(PAGE);
+                    }
+
+                    for(U32 INDEX = FIRST; INDEX <= LAST; INDEX++)
+                    {
+                        const std::size_t BIT = (static_cast<std::size_t>(PAGE) << SHIFT) + INDEX;
+                        if(DIRTY_TRACKER::TEST(STATE.GRANULES, BIT)) continue;
+
+                        DIRTY_TRACKER::SET(STATE.GRANULES, BIT);
+                        U8* const HOST = PAGE_HOST(ENTRY) + (static_cast<std::size_t>(INDEX) << STATE.GRANULE_BITS);
+                        STATE.CAPTURE(HOST, std::size_t{1} << STATE.GRANULE_BITS, OWNER_KEY(HOST));
+                    }
+
+                    if(SHIFT == 0)
+                        TABLE.SET(PAGE, TABLE[PAGE] & ~PAGE_TRACKED);
+                }
+
+                // THE SAME FOR RAM WITHIN A SPLIT PAGE, WHICH CAN'T CARRY A TRAP OF IT'S OWN
+                // PRE-IMAGES ARE TAKEN A LINE AT A TIME, AS A WHOLE GRANULE MAY RUN PAST THE HOST MEMORY BEHIND THE REGION -
+                // THE GRANULE IS STILL MARKED, SO IS_DIRTY AND THE DIRTY PAGES READ THE SAME AS FOR ANY OTHER RAM
+                NOODLE_NO_INLINE void TRACK_LINES(U32 ADDRESS, std::size_t LENGTH, std::uintptr_t ADDEND)
+                {
+                    // HELD ONLY TO SERIALISE TRACKED WRITES, AS IN TRACK
+                    auto&& TABLE = PAGES.EDIT();
+                    (void)TABLE;
+
+                    if(!TRACKER) return;
+                    DIRTY_TRACKER& STATE = *TRACKER;
+
+                    const U32 PAGE = ADDRESS >> PAGE_BITS;
+
+                    if(!DIRTY_TRACKER::TEST(STATE.DIRTY_MAP, PAGE))
+                    {
+                        DIRTY_TRACKER::SET(STATE.DIRTY_MAP, PAGE);
+                        STATE.DIRTY.push_back(PAGE);
+                    }
+
+                    for(U32 LINE = ADDRESS >> SPLIT_BITS; LINE <= (ADDRESS + LENGTH - 1) >> SPLIT_BITS; LINE++)
+                    {
+                        DIRTY_TRACKER::SET(STATE.GRANULES, (LINE << SPLIT_BITS) >> STATE.GRANULE_BITS);
+                        if(!STATE.LINES.insert(LINE).second) continue;
+
+                        U8* const HOST = reinterpret_cast<U8*>(ADDEND + ((LINE << SPLIT_BITS) & PAGE_MASK));
+                        STATE.CAPTURE(HOST, SPLIT_SIZE, OWNER_KEY(HOST));
+                    }
+                }
+
+                // CLEAR THE BITS OF EVERY PAGE DIRTIED THIS EPOCH AND RE-ARM IT'S TRAP
+                // ONLY THE DIRTY PAGES ARE VISITED, NOT THE WHOLE BITMAP
+                //
+                // RETURNS WHETHER ANY LIFTED TRAP WAS RE-ARMED, AS A TLB MAY HAVE CACHED THOSE PAGES AS DIRECT
+                template<typename TABLE_EDIT>
+                bool REARM(TABLE_EDIT& TABLE)
+                {
+                    DIRTY_TRACKER& STATE = *TRACKER;
+                    const U32 SHIFT = PAGE_BITS - STATE.GRANULE_BITS;
+
+                    for(const U32 PAGE : STATE.DIRTY)
+                    {
+                        DIRTY_TRACKER::CLEAR(STATE.GRANULES, static_cast<std::size_t>(PAGE) << SHIFT, std::size_t{1} << SHIFT);
+                        DIRTY_TRACKER::CLEAR(STATE.DIRTY_MAP, PAGE, 1);
+
+                        const PAGE_ENTRY ENTRY = TABLE[PAGE];
+                        if((ENTRY & (PAGE_MMIO | PAGE_WRITEABLE)) == PAGE_WRITEABLE)
+                            TABLE.SET(PAGE, ENTRY | PAGE_TRACKED);
+                    }
+
+                    const bool LIFTED = SHIFT == 0 && !STATE.DIRTY.empty();
+                    STATE.DIRTY.clear();
+                    STATE.LINES.clear();
+                    return LIFTED;
+                }
+
+            public:
+                using ENDIAN_POLICY = ENDIAN;
+
+                // HOT TABLE - ONE 8 BYTE ENTRY PER PAGE (16KB FOR THE DEFAULT GEOMETRY)
+                typename SYNC::template PAGE_TABLE<PAGE_ENTRY, PAGE_COUNT, PAGE_UNMAPPED> PAGES;
+
+                // BUMPED BY EVERY CALL WHICH CHANGES THE PAGE TABLE, ONCE THE CHANGE IS VISIBLE
+                // ANY TRANSLATION CACHED IN FRONT OF THE BUS COMPARES AGAINST THIS TO KNOW WHEN IT IS STALE
+                typename SYNC::COUNTER GENERATION{0};
+
+                // RESOLVE THE HOST POINTER BEHIND A RAM ENTRY
+                static NOODLE_FORCE_INLINE U8* PAGE_HOST(PAGE_ENTRY ENTRY)
+                {
+                    return reinterpret_cast<U8*>(ENTRY & ~PAGE_FLAG_MASK);
+                }
+
+                static U8 READ_8(U32, void*) { return 0; }
+                static U16 READ_16(U32, void*) { return 0; }
+                static U32 READ_32(U32, void*) { return 0; }
+                static void WRITE_8(U32, U8, void*) {}
+                static void WRITE_16(U32, U16, void*) {}
+                static void WRITE_32(U32, U32, void*) {}
+
+                // TYPED READ AND WRITE ENTRY POINTS FOR THE BUS
+                // WHEN A PAGE HAS A BACKING ARRAY, THE ACCESS IS A MASKED LOAD/STORE STRAIGHT
+                // FROM THAT ARRAY - THE ONLY CHECKS BEING THE PAGE FLAGS AND THAT THE ACCESS DOESN'T STRADDLE THE PAGE
+                //
+                // EVERYTHING ELSE (MMIO, UNMAPPED, ROM WRITES, PAGE CROSSINGS) IS DEFERRED
+                // TO THE OUT OF LINE SLOW PATH SO THAT THE RAM CASE INLINES INTO THE CALLER - SAVE FOR RAM WITHIN
+                // A SPLIT PAGE, WHICH IS LOOKED UP IN IT'S LINE TABLE ON THE WAY THERE
+                template<typename T>
+                NOODLE_FORCE_INLINE T READ(U32 ADDRESS) const
+                {
+                    static_assert(FUJIKO_BUS_WIDTH<T>, "BUS READS MUST BE U8, U16 OR U32");
+
+                    const U32 MASKED = ADDRESS & ADDRESS_MASK;
+                    const U32 OFFSET = MASKED & PAGE_MASK;
+                    const PAGE_ENTRY ENTRY = PAGES[MASKED >> PAGE_BITS];
+
+                    if(NOODLE_LIKELY(READ_DIRECT(ENTRY) && OFFSET <= PAGE_SIZE - sizeof(T)))
+                    {
+                        T VALUE;
+                        std::memcpy(&VALUE, PAGE_HOST(ENTRY) + OFFSET, sizeof(T));
+                        return PROFILED(MASKED, ENDIAN::CONVERT(VALUE), watch::READ);
+                    }
+
+                    if(const U8* HOST = SPLIT_HOST<T, false>(MASKED, ENTRY))
+                    {
+                        T VALUE;
+                        std::memcpy(&VALUE, HOST, sizeof(T));
+                        return PROFILED(MASKED, ENDIAN::CONVERT(VALUE), watch::READ);
+                    }
+
+                    return PROFILED(MASKED, READ_SLOW<T>(MASKED, ENTRY), watch::READ);
+                }
+
+                template<typename T>
+                NOODLE_FORCE_INLINE void WRITE(U32 ADDRESS, T VALUE)
+                {
+                    static_assert(FUJIKO_BUS_WIDTH<T>, "BUS WRITES MUST BE U8, U16 OR U32");
+
+                    const U32 MASKED = ADDRESS & ADDRESS_MASK;
+                    const U32 OFFSET = MASKED & PAGE_MASK;
+                    const PAGE_ENTRY ENTRY = PAGES[MASKED >> PAGE_BITS];
+                    PROFILED(MASKED, VALUE, watch::WRITE);
+
+                    if(NOODLE_LIKELY(WRITE_DIRECT(ENTRY) && OFFSET <= PAGE_SIZE - sizeof(T)))
+                    {
+                        VALUE = ENDIAN::CONVERT(VALUE);
+                        std::memcpy(PAGE_HOST(ENTRY) + OFFSET, &VALUE, sizeof(T));
+                        return;
+                    }
+
+                    if(U8* HOST = SPLIT_HOST<T, true>(MASKED, ENTRY))
+                    {
+                        VALUE = ENDIAN::CONVERT(VALUE);
+                        std::memcpy(HOST, &VALUE, sizeof(T));
+                        return;
+                    }
+
+                    WRITE_SLOW<T>(MASKED, VALUE, ENTRY);
+                }
+
+                // INSTRUCTION FETCH - IDENTICAL TO A READ, SAVE FOR BEING REPORTED TO EXECUTE WATCHPOINTS
+                template<typename T>
+                NOODLE_FORCE_INLINE T FETCH(U32 ADDRESS) const
+                {
+                    static_assert(FUJIKO_BUS_WIDTH<T>, "BUS FETCHES MUST BE U8, U16 OR U32");
+
+                    const U32 MASKED = ADDRESS & ADDRESS_MASK;
+                    const U32 OFFSET = MASKED & PAGE_MASK;
+                    const PAGE_ENTRY ENTRY = PAGES[MASKED >> PAGE_BITS];
+
+                    if(NOODLE_LIKELY(READ_DIRECT(ENTRY) && OFFSET <= PAGE_SIZE - sizeof(T)))
+                    {
+                        T VALUE;
+                        std::memcpy(&VALUE, PAGE_HOST(ENTRY) + OFFSET, sizeof(T));
+                        return PROFILED(MASKED, ENDIAN::CONVERT(VALUE), watch::EXECUTE);
+                    }
+
+                    if(const U8* HOST = SPLIT_HOST<T, false>(MASKED, ENTRY))
+                    {
+                        T VALUE;
+                        std::memcpy(&VALUE, HOST, sizeof(T));
+                        return PROFILED(MASKED, ENDIAN::CONVERT(VALUE), watch::EXECUTE);
+                    }
+
+                    return PROFILED(MASKED, READ_SLOW<T>(MASKED, ENTRY, watch::EXECUTE), watch::EXECUTE);
+                }
+
+                // CHECKED ACCESSES FOR A CORE WHICH RAISES A BUS ERROR RATHER THAN SEEING OPEN BUS
+                // AN ACCESS TOUCHING AN UNMAPPED PAGE IS RETURNED AS AN OUT OF BOUNDS FAULT, WITH THE ADDRESS AS IT'S CODE -
+                // ANY OTHER ACCESS COSTS ONE MORE TEST OF THE PAGE ENTRY THAN A PLAIN READ OR WRITE
+                template<typename T>
+                NOODLE_FORCE_INLINE RESULT<T> TRY_READ(U32 ADDRESS) const
+                {
+                    const U32 MASKED = ADDRESS & ADDRESS_MASK;
+
+                    if(NOODLE_UNLIKELY(UNMAPPED(MASKED, sizeof(T))))
+                        return BUS_FAULT("READ", MASKED);
+
+                    return READ<T>(MASKED);
+                }
+
+                template<typename T>
+                NOODLE_FORCE_INLINE RESULT<void> TRY_WRITE(U32 ADDRESS, T VALUE)
+                {
+                    const U32 MASKED = ADDRESS & ADDRESS_MASK;
+
+                    if(NOODLE_UNLIKELY(UNMAPPED(MASKED, sizeof(T))))
+                        return BUS_FAULT("WRITE", MASKED);
+
+                    WRITE<T>(MASKED, VALUE);
+                    return noodle::err::SUCCESS();
+                }
+
+                // BULK TRANSFERS - THE DMA PATH
+                // EACH REQUEST IS SPLIT AT PAGE BOUNDARIES, WITH NEIGHBOURING RAM PAGES WHOSE HOST MEMORY IS CONTIGUOUS
+                // BEING COALESCED INTO A SINGLE RUN - EACH RUN IS THEN ONE MEMCPY/MEMSET
+                //
+                // MIRRORED PAGES BREAK A RUN NATURALLY, AS THEIR HOST POINTERS WRAP BACK AROUND
+                // ANYTHING WHICH ISN'T DIRECT RAM (MMIO, UNMAPPED, ROM WRITES) FALLS BACK TO THE SLOW PATH, LOOKING THE PAGE UP
+                // ONCE PER RUN AND MOVING A DEVICE'S REGISTERS IN THE WIDEST PIECES IT HAS HANDLERS FOR (SEE BLOCK_WIDTH)
+                void READ_BLOCK(U32 ADDRESS, U8* DST, std::size_t LENGTH) const
+                {
+                    while(LENGTH > 0)
+                    {
+                        const U32 MASKED = ADDRESS & ADDRESS_MASK;
+                        const PAGE_ENTRY ENTRY = PAGES[MASKED >> PAGE_BITS];
+                        const std::size_t RUN = RUN_LENGTH(MASKED, LENGTH, ENTRY, READ_DIRECT(ENTRY));
+
+                        if(READ_DIRECT(ENTRY))
+                            std::memcpy(DST, PAGE_HOST(ENTRY) + (MASKED & PAGE_MASK), RUN);
+                        else
+                            READ_RUN(MASKED, DST, RUN, ENTRY);
+
+                        ADDRESS += static_cast<U32>(RUN);
+                        DST += RUN;
+                        LENGTH -= RUN;
+                    }
+                }
+
+                void WRITE_BLOCK(U32 ADDRESS, const U8* SRC, std::size_t LENGTH)
+                {
+                    while(LENGTH > 0)
+                    {
+                        const U32 MASKED = ADDRESS & ADDRESS_MASK;
+                        const PAGE_ENTRY ENTRY = PAGES[MASKED >> PAGE_BITS];
+                        const std::size_t RUN = RUN_LENGTH(MASKED, LENGTH, ENTRY, WRITE_DIRECT(ENTRY));
+
+                        if(WRITE_DIRECT(ENTRY))
+                            std::memcpy(PAGE_HOST(ENTRY) + (MASKED & PAGE_MASK), SRC, RUN);
+                        else if(WRITE_TRACKED(ENTRY))
+                        {
+                            TRACK(MASKED, RUN, ENTRY);
+                            std::memcpy(PAGE_HOST(ENTRY) + (MASKED & PAGE_MASK), SRC, RUN);
+                        }
+                        else
+                            WRITE_RUN(MASKED, SRC, RUN, ENTRY);
+
+                        ADDRESS += static_cast<U32>(RUN);
+                        SRC += RUN;
+                        LENGTH -= RUN;
+                    }
+                }
+
+                void FILL(U32 ADDRESS, U8 VALUE, std::size_t LENGTH)
+                {
+                    const U8 PATTERN[4] = { VALUE, VALUE, VALUE, VALUE };
+
+                    while(LENGTH > 0)
+                    {
+                        const U32 MASKED = ADDRESS & ADDRESS_MASK;
+                        const PAGE_ENTRY ENTRY = PAGES[MASKED >> PAGE_BITS];
+                        const std::size_t RUN = RUN_LENGTH(MASKED, LENGTH, ENTRY, WRITE_DIRECT(ENTRY));
+
+                        if(WRITE_DIRECT(ENTRY))
+                            std::memset(PAGE_HOST(ENTRY) + (MASKED & PAGE_MASK), VALUE, RUN);
+                        else if(WRITE_TRACKED(ENTRY))
+                        {
+                            TRACK(MASKED, RUN, ENTRY);
+                            std::memset(PAGE_HOST(ENTRY) + (MASKED & PAGE_MASK), VALUE, RUN);
+                        }
+                        else
+                            WRITE_RUN(MASKED, PATTERN, RUN, ENTRY, true);
+
+                        ADDRESS += static_cast<U32>(RUN);
+                        LENGTH -= RUN;
+                    }
+                }
+
+                // TYPED BLOCK TRANSFERS OF COUNT 16 OR 32-BIT VALUES BETWEEN THE BUS AND HOST ORDER
+                // THE BYTES MOVE AS ABOVE, AFTER WHICH THE WHOLE BLOCK IS CONVERTED IN ONE VECTORISED PASS
+                // RATHER THAN SWAPPING A VALUE AT A TIME - WITH A NATIVE POLICY THIS IS A PLAIN BLOCK TRANSFER
+                template<typename T>
+                void READ_BLOCK(U32 ADDRESS, T* DST, std::size_t COUNT) const
+                {
+                    static_assert(std::is_same<T, U16>::value || std::is_same<T, U32>::value, "TYPED BLOCKS MUST BE U16 OR U32");
+
+                    READ_BLOCK(ADDRESS, reinterpret_cast<U8*>(DST), COUNT * sizeof(T));
+
+                    if constexpr (ENDIAN::SWAPS)
+                        bits::SWAP_BLOCK(DST, DST, COUNT);
+                }
+
+                template<typename T>
+                void WRITE_BLOCK(U32 ADDRESS, const T* SRC, std::size_t COUNT)
+                {
+                    static_assert(std::is_same<T, U16>::value || std::is_same<T, U32>::value, "TYPED BLOCKS MUST BE U16 OR U32");
+
+                    if constexpr (!ENDIAN::SWAPS)
+                        WRITE_BLOCK(ADDRESS, reinterpret_cast<const U8*>(SRC), COUNT * sizeof(T));
+                    else
+                    {
+                        // THE SOURCE IS CONST, SO EACH CHUNK IS SWAPPED INTO A SMALL STAGING BUFFER
+                        alignas(32) T STAGE[256 / sizeof(T)];
+
+                        while(COUNT > 0)
+                        {
+                            const std::size_t CHUNK = std::min<std::size_t>(COUNT, std::size(STAGE));
+                            bits::SWAP_BLOCK(STAGE, SRC, CHUNK);
+                            WRITE_BLOCK(ADDRESS, reinterpret_cast<const U8*>(STAGE), CHUNK * sizeof(T));
+
+                            ADDRESS += static_cast<U32>(CHUNK * sizeof(T));
+                            SRC += CHUNK;
+                            COUNT -= CHUNK;
+                        }
+                    }
+                }
+
+                // BUS TO BUS COPY WITH MEMMOVE SEMANTICS OVER GUEST ADDRESSES
+                // WHEN THE DESTINATION OVERLAPS THE TAIL OF THE SOURCE, THE COPY IS CARRIED OUT FROM THE END BACKWARDS
+                // WHENEVER BOTH SIDES OF A RUN ARE DIRECT RAM THE RUN IS A SINGLE MEMMOVE, OTHERWISE IT IS
+                // STAGED THROUGH A SMALL BUFFER USING THE BLOCK READ AND WRITE ABOVE
+                void COPY(U32 DST, U32 SRC, std::size_t LENGTH)
+                {
+                    const U32 DISTANCE = (DST - SRC) & ADDRESS_MASK;
+                    const bool BACKWARDS = DISTANCE != 0 && DISTANCE < LENGTH;
+
+                    while(LENGTH > 0)
+                    {
+                        // THE PAGES OF THE CURRENT RUN, TAKEN FROM EITHER END OF THE REMAINING RANGE
+                        const U32 SRC_EDGE = (BACKWARDS ? SRC + static_cast<U32>(LENGTH) - 1 : SRC) & ADDRESS_MASK;
+                        const U32 DST_EDGE = (BACKWARDS ? DST + static_cast<U32>(LENGTH) - 1 : DST) & ADDRESS_MASK;
+
+                        const PAGE_ENTRY SRC_ENTRY = PAGES[SRC_EDGE >> PAGE_BITS];
+                        const PAGE_ENTRY DST_ENTRY = PAGES[DST_EDGE >> PAGE_BITS];
+                        const bool DIRECT = READ_DIRECT(SRC_ENTRY) && WRITE_DIRECT(DST_ENTRY);
+
+                        std::size_t RUN = std::min<std::size_t>(LENGTH, DIRECT ? PAGE_SIZE : COPY_STAGE);
+
+                        if(BACKWARDS)
+                        {
+                            RUN = std::min<std::size_t>(RUN, (SRC_EDGE & PAGE_MASK) + 1);
+                            RUN = std::min<std::size_t>(RUN, (DST_EDGE & PAGE_MASK) + 1);
+                        }
+                        else
+                        {
+                            RUN = std::min<std::size_t>(RUN, PAGE_SIZE - (SRC_EDGE & PAGE_MASK));
+                            RUN = std::min<std::size_t>(RUN, PAGE_SIZE - (DST_EDGE & PAGE_MASK));
+                        }
+
+                        const U32 SRC_ADDRESS = BACKWARDS ? ((SRC_EDGE - static_cast<U32>(RUN) + 1) & ADDRESS_MASK) : SRC_EDGE;
+                        const U32 DST_ADDRESS = BACKWARDS ? ((DST_EDGE - static_cast<U32>(RUN) + 1) & ADDRESS_MASK) : DST_EDGE;
+
+                        if(DIRECT)
+                        {
+                            std::memmove(PAGE_HOST(DST_ENTRY) + (DST_ADDRESS & PAGE_MASK),
+                                         PAGE_HOST(SRC_ENTRY) + (SRC_ADDRESS & PAGE_MASK), RUN);
+                        }
+                        else
+                        {
+                            U8 STAGE[COPY_STAGE];
+                            READ_BLOCK(SRC_ADDRESS, STAGE, RUN);
+                            WRITE_BLOCK(DST_ADDRESS, STAGE, RUN);
+                        }
+
+                        if(!BACKWARDS)
+                        {
+                            SRC += static_cast<U32>(RUN);
+                            DST += static_cast<U32>(RUN);
+                        }
+
+                        LENGTH -= RUN;
+                    }
+                }
+
+                // WATCHPOINTS
+                // ONLY THE PAGES A RANGE OVERLAPS ARE TRAPPED, SO EVERY OTHER PAGE KEEPS IT'S FAST PATH UNTOUCHED
+                // ACCESS IS A MASK OF watch::READ, WRITE AND EXECUTE - EXECUTE ONLY SEES ACCESSES MADE THROUGH FETCH
+                //
+                // THE CALLBACK RUNS AFTER THE ACCESS HAS COMPLETED, AND MUST NOT ADD OR REMOVE WATCHPOINTS ITSELF
+                U32 ADD_WATCH(U32 START, U32 END, U8 ACCESS, FUJIKO_WATCH_CALLBACK CALLBACK, void* CTX = nullptr)
+                {
+                    START &= ADDRESS_MASK;
+                    END &= ADDRESS_MASK;
+
+                    if(CALLBACK == nullptr || END < START || (ACCESS & (watch::READ | watch::WRITE | watch::EXECUTE)) == 0)
+                    {
+                        NOODLE_INVALID_ARG_ERROR("ADD_WATCH: INVALID WATCHPOINT 0x{:08X}-0x{:08X} ({:#X})", START, END, ACCESS);
+                        return ~0U;
+                    }
+
+                    const auto POS = std::upper_bound(WATCHES.begin(), WATCHES.end(), START,
+                                        [](U32 KEY, const WATCH_RANGE& RANGE) { return KEY < RANGE.START; });
+
+                    WATCHES.insert(POS, WATCH_RANGE{ START, END, NEXT_WATCH, ACCESS, CALLBACK, CTX });
+                    REBUILD_REACH();
+
+                    // THE EDIT IS PUBLISHED AS IT GOES OUT OF SCOPE, BEFORE THE GENERATION MOVES ON
+                    {
+                        auto&& TABLE = PAGES.EDIT();
+                        RETRAP(TABLE, START >> PAGE_BITS, END >> PAGE_BITS);
+                    }
+
+                    GENERATION++;
+                    return NEXT_WATCH++;
+                }
+
+                bool REMOVE_WATCH(U32 ID)
+                {
+                    const auto POS = std::find_if(WATCHES.begin(), WATCHES.end(), [ID](const WATCH_RANGE& RANGE) { return RANGE.ID == ID; });
+                    if(POS == WATCHES.end()) return false;
+
+                    const U32 START = POS->START;
+                    const U32 END = POS->END;
+
+                    WATCHES.erase(POS);
+                    REBUILD_REACH();
+
+                    {
+                        auto&& TABLE = PAGES.EDIT();
+                        RETRAP(TABLE, START >> PAGE_BITS, END >> PAGE_BITS);
+                    }
+
+                    GENERATION++;
+                    return true;
+                }
+
+                void CLEAR_WATCHES()
+                {
+                    {
+                        auto&& TABLE = PAGES.EDIT();
+
+                        for(const WATCH_RANGE& RANGE : WATCHES)
+                        {
+                            for(U32 INDEX = RANGE.START >> PAGE_BITS; INDEX <= (RANGE.END >> PAGE_BITS); INDEX++)
+                            {
+                                const PAGE_ENTRY ENTRY = TABLE[INDEX];
+                                if(ENTRY & PAGE_TRAPS) TABLE.SET(INDEX, ENTRY & ~PAGE_TRAPS);
+                            }
+                        }
+                    }
+
+                    WATCHES.clear();
+                    REBUILD_REACH();
+                    GENERATION++;
+                }
+
+                std::size_t WATCH_COUNT() const { return WATCHES.size(); }
+
+                // HOW MANY OBJECTS THE BUS IS HOLDING ON BEHALF OF IT'S PAGES - RETIRED ONES WAITING ON READERS AREN'T COUNTED
+                std::size_t OWNED_COUNT() const { return OWNERSHIP.size(); }
+
+                // ACCESS PROFILING - ONLY AVAILABLE IN BUILDS WITH NOODLE_BUS_PROFILE SET
+                // COUNTS EVERY TYPED READ, WRITE AND FETCH PER PAGE AND WIDTH, AND WHEN TRACE_RECORDS IS NON-ZERO
+                // (A POWER OF TWO) ALSO KEEPS THE MOST RECENT ACCESSES IN A RING
+                //
+                // BLOCK TRANSFERS AND TLB HITS NEVER REACH THE TYPED PATH, AND SO ARE NOT COUNTED
+                // THE COUNTERS TAKE 48 BYTES PER PAGE - 96KB FOR THE DEFAULT GEOMETRY, BUT 48MB FOR 4KB PAGES OVER 32 BITS
+                // STARTING AGAIN DISCARDS EVERYTHING GATHERED SO FAR - ON A SHARED BUS, ONCE EVERY READER HAS QUIESCED
+                bool START_PROFILE(std::size_t TRACE_RECORDS = 0)
+                {
+                    #if NOODLE_BUS_PROFILE
+                        if(TRACE_RECORDS & (TRACE_RECORDS - 1) || TRACE_RECORDS > (std::size_t{1} << 31))
+                        {
+                            NOODLE_INVALID_ARG_ERROR("START_PROFILE: {} TRACE RECORDS IS NOT A POWER OF TWO", TRACE_RECORDS);
+                            return false;
+                        }
+
+                        auto PROFILE = std::make_shared<BUS_PROFILE>();
+                        PROFILE->COUNTS.reset(new std::atomic<U64>[static_cast<std::size_t>(PAGE_COUNT) * 6]());
+
+                        if(TRACE_RECORDS != 0)
+                        {
+                            PROFILE->RING.reset(new FUJIKO_TRACE_RECORD[TRACE_RECORDS]());
+                            PROFILE->RING_MASK = static_cast<U32>(TRACE_RECORDS - 1);
+                        }
+
+                        PUBLISH_PROFILE(std::move(PROFILE));
+                        return true;
+                    #else
+                        NOODLE_UNIMPL_ERROR("START_PROFILE: BUILT WITHOUT NOODLE_BUS_PROFILE");
+                        return false;
+                    #endif
+                }
+
+                void STOP_PROFILE()
+                {
+                    #if NOODLE_BUS_PROFILE
+                        PUBLISH_PROFILE(nullptr);
+                    #endif
+                }
+
+                bool PROFILING() const
+                {
+                    #if NOODLE_BUS_PROFILE
+                        return PROFILER.load(std::memory_order_acquire) != nullptr;
+                    #else
+                        return false;
+                    #endif
+                }
+
+                // EVERY PAGE WHICH HAS SEEN AN ACCESS, HOTTEST FIRST
+                std::vector<FUJIKO_PAGE_HEAT> HEATMAP() const
+                {
+                    std::vector<FUJIKO_PAGE_HEAT> HEAT;
+
+                    #if NOODLE_BUS_PROFILE
+                        const BUS_PROFILE* PROFILE = PROFILER.load(std::memory_order_acquire);
+                        if(!PROFILE) return HEAT;
+
+                        for(U32 PAGE = 0; PAGE < PAGE_COUNT; PAGE++)
+                        {
+                            const std::atomic<U64>* COUNTS = &PROFILE->COUNTS[static_cast<std::size_t>(PAGE) * 6];
+                            FUJIKO_PAGE_HEAT ENTRY{ PAGE << PAGE_BITS, {}, {} };
+
+                            for(U32 WIDTH = 0; WIDTH < 3; WIDTH++)
+                            {
+                                ENTRY.READS[WIDTH] = COUNTS[WIDTH].load(std::memory_order_relaxed);
+                                ENTRY.WRITES[WIDTH] = COUNTS[3 + WIDTH].load(std::memory_order_relaxed);
+                            }
+
+                            if(ENTRY.TOTAL() != 0)
+                                HEAT.push_back(ENTRY);
+                        }
+
+                        std::stable_sort(HEAT.begin(), HEAT.end(), [](const FUJIKO_PAGE_HEAT& LHS, const FUJIKO_PAGE_HEAT& RHS)
+                        {
+                            return LHS.TOTAL() > RHS.TOTAL();
+                        });
+                    #endif
+
+                    return HEAT;
+                }
+
+                // THE TRACE RING IN ORDER, OLDEST FIRST - TAKEN WITH THE BUS OTHERWISE IDLE
+                std::vector<FUJIKO_TRACE_RECORD> TRACE() const
+                {
+                    std::vector<FUJIKO_TRACE_RECORD> RECORDS;
+
+                    #if NOODLE_BUS_PROFILE
+                        const BUS_PROFILE* PROFILE = PROFILER.load(std::memory_order_acquire);
+                        if(!PROFILE || !PROFILE->RING) return RECORDS;
+
+                        const U32 HEAD = PROFILE->HEAD;
+                        const U32 COUNT = std::min<U32>(HEAD, PROFILE->RING_MASK + 1);
+
+                        for(U32 INDEX = HEAD - COUNT; INDEX != HEAD; INDEX++)
+                            RECORDS.push_back(PROFILE->RING[INDEX & PROFILE->RING_MASK]);
+                    #endif
+
+                    return RECORDS;
+                }
+
+                // WRITE THE TRACE OUT AS A COMPACT LITTLE-ENDIAN BINARY FILE:
+                // "NTRC", A U32 VERSION AND A U32 RECORD COUNT, THEN TEN BYTES PER RECORD -
+                // U32 ADDRESS, U32 VALUE, U8 SIZE, U8 ACCESS
+                bool DUMP_TRACE(const char* PATH) const
+                {
+                    #if !NOODLE_BUS_PROFILE
+                        NOODLE_UNIMPL_ERROR("DUMP_TRACE: BUILT WITHOUT NOODLE_BUS_PROFILE");
+                        return false;
+                    #endif
+
+                    const std::vector<FUJIKO_TRACE_RECORD> RECORDS = TRACE();
+                    std::vector<U8> OUT(12 + RECORDS.size() * 10);
+
+                    std::memcpy(OUT.data(), "NTRC", 4);
+                    bits::STORE_LITTLE<U32>(OUT.data() + 4, 1);
+                    bits::STORE_LITTLE<U32>(OUT.data() + 8, static_cast<U32>(RECORDS.size()));
+
+                    U8* CURSOR = OUT.data() + 12;
+
+                    for(const FUJIKO_TRACE_RECORD& RECORD : RECORDS)
+                    {
+                        bits::STORE_LITTLE<U32>(CURSOR, RECORD.ADDRESS);
+                        bits::STORE_LITTLE<U32>(CURSOR + 4, RECORD.VALUE);
+                        CURSOR[8] = RECORD.SIZE;
+                        CURSOR[9] = RECORD.ACCESS;
+                        CURSOR += 10;
+                    }
+
+                    std::FILE* FILE = std::fopen(PATH, "wb");
+
+                    if(FILE == nullptr)
+                    {
+                        NOODLE_RESOURCE_ERROR("DUMP_TRACE: CANNOT OPEN {}", PATH);
+                        return false;
+                    }
+
+                    const bool WRITTEN = std::fwrite(OUT.data(), 1, OUT.size(), FILE) == OUT.size();
+                    std::fclose(FILE);
+
+                    if(!WRITTEN)
+                        NOODLE_RESOURCE_ERROR("DUMP_TRACE: SHORT WRITE TO {}", PATH);
+
+                    return WRITTEN;
+                }
+
+                // DIRTY TRACKING AND INCREMENTAL SNAPSHOTS
+                // ONCE ENABLED, EVERY WRITEABLE RAM PAGE TRAPS IT'S WRITES SO THAT THE FIRST WRITE TO EACH GRANULE
+                // SINCE THE LAST SNAPSHOT CAN BE RECORDED - GRANULE_BITS == PAGE_BITS TRACKS WHOLE PAGES, WHICH ONLY COSTS
+                // THE FIRST WRITE TO EACH PAGE, WHILST A FINER GRANULE CAPTURES LESS AT THE COST OF TRAPPING EVERY WRITE
+                //
+                // THE BITMAP HOLDS ONE BIT PER GRANULE OF THE WHOLE ADDRESS SPACE (256KB FOR THE DEFAULT GEOMETRY AT 64 BYTE GRANULES)
+                bool ENABLE_TRACKING(U32 GRANULE_BITS = PAGE_BITS)
+                {
+                    if(GRANULE_BITS > PAGE_BITS)
+                    {
+                        NOODLE_INVALID_ARG_ERROR("ENABLE_TRACKING: GRANULE OF {} BITS IS LARGER THAN A {} BIT PAGE", GRANULE_BITS, PAGE_BITS);
+                        return false;
+                    }
+
+                    const std::size_t GRANULE_COUNT = static_cast<std::size_t>(PAGE_COUNT) << (PAGE_BITS - GRANULE_BITS);
+
+                    TRACKER = std::make_unique<DIRTY_TRACKER>();
+                    TRACKER->GRANULE_BITS = GRANULE_BITS;
+                    TRACKER->GRANULES.assign((GRANULE_COUNT + 63) / 64, 0);
+                    TRACKER->DIRTY_MAP.assign((PAGE_COUNT + 63) / 64, 0);
+
+                    {
+                        auto&& TABLE = PAGES.EDIT();
+
+                        for(U32 INDEX = 0; INDEX < PAGE_COUNT; INDEX++)
+                        {
+                            const PAGE_ENTRY ENTRY = TABLE[INDEX];
+                            if((ENTRY & (PAGE_MMIO | PAGE_WRITEABLE)) == PAGE_WRITEABLE)
+                                TABLE.SET(INDEX, ENTRY | PAGE_TRACKED);
+                        }
+                    }
+
+                    GENERATION++;
+                    return true;
+                }
+
+                // LIFT EVERY TRAP AND DISCARD ALL SNAPSHOTS
+                void DISABLE_TRACKING()
+                {
+                    {
+                        auto&& TABLE = PAGES.EDIT();
+
+                        for(U32 INDEX = 0; INDEX < PAGE_COUNT; INDEX++)
+                        {
+                            const PAGE_ENTRY ENTRY = TABLE[INDEX];
+                            if((ENTRY & (PAGE_MMIO | PAGE_TRACKED)) == PAGE_TRACKED)
+                                TABLE.SET(INDEX, ENTRY & ~PAGE_TRACKED);
+                        }
+
+                        TRACKER.reset();
+                    }
+
+                    GENERATION++;
+                }
+
+                bool TRACKING() const { return TRACKER != nullptr; }
+
+                // HAS THE GRANULE HOLDING ADDRESS BEEN WRITTEN SINCE THE LAST SNAPSHOT
+                bool IS_DIRTY(U32 ADDRESS) const
+                {
+                    if(!TRACKER) return false;
+
+                    const U32 MASKED = ADDRESS & ADDRESS_MASK;
+                    return DIRTY_TRACKER::TEST(TRACKER->GRANULES, MASKED >> TRACKER->GRANULE_BITS);
+                }
+
+                std::size_t DIRTY_PAGE_COUNT() const { return TRACKER ? TRACKER->DIRTY.size() : 0; }
+                std::size_t SNAPSHOT_BYTES() const { return TRACKER ? TRACKER->ARENA.size() : 0; }
+
+                // TAKE A SNAPSHOT OF THE MAPPED RAM, RETURNING IT'S ID
+                // NOTHING IS COPIED HERE - THE DIRTY SET IS SIMPLY CLEARED, SO THE NEXT WRITES CAPTURE THIS STATE
+                U32 SNAPSHOT()
+                {
+                    if(!TRACKER)
+                    {
+                        NOODLE_LOGIC_ERROR("SNAPSHOT: DIRTY TRACKING IS NOT ENABLED");
+                        return 0;
+                    }
+
+                    bool LIFTED = false;
+
+                    {
+                        auto&& TABLE = PAGES.EDIT();
+                        LIFTED = REARM(TABLE);
+                        TRACKER->EPOCHS.push_back(TRACKER->LOG.size());
+                    }
+
+                    if(LIFTED)
+                        GENERATION++;
+
+                    return TRACKER->BASE_ID + static_cast<U32>(TRACKER->EPOCHS.size() - 1);
+                }
+
+                // ROLL THE MAPPED RAM BACK TO A SNAPSHOT
+                // EVERY LATER SNAPSHOT IS DISCARDED, WHILST THE ONE RESTORED REMAINS VALID TO RESTORE AGAIN
+                bool RESTORE(U32 ID)
+                {
+                    if(!TRACKER || ID < TRACKER->BASE_ID || ID - TRACKER->BASE_ID >= TRACKER->EPOCHS.size())
+                    {
+                        NOODLE_OOB_ERROR("RESTORE: NO SNAPSHOT WITH ID {}", ID);
+                        return false;
+                    }
+
+                    DIRTY_TRACKER& STATE = *TRACKER;
+                    const std::size_t START = STATE.EPOCHS[ID - STATE.BASE_ID];
+
+                    for(std::size_t INDEX = STATE.LOG.size(); INDEX-- > START;)
+                    {
+                        const typename DIRTY_TRACKER::UNDO_RECORD& RECORD = STATE.LOG[INDEX];
+                        if(RECORD.HOST == nullptr) continue;
+
+                        std::memcpy(RECORD.HOST, STATE.ARENA.data() + RECORD.OFFSET, RECORD.LENGTH);
+                    }
+
+                    // TRUNCATING KEEPS THE ARENA'S CAPACITY FOR THE NEXT EPOCH
+                    if(START < STATE.LOG.size())
+                        STATE.ARENA.resize(STATE.LOG[START].OFFSET);
+
+                    STATE.LOG.resize(START);
+                    STATE.EPOCHS.resize(ID - STATE.BASE_ID + 1);
+
+                    bool LIFTED = false;
+
+                    {
+                        auto&& TABLE = PAGES.EDIT();
+                        LIFTED = REARM(TABLE);
+                    }
+
+                    if(LIFTED)
+                        GENERATION++;
+
+                    return true;
+                }
+
+                // DISCARD EVERY SNAPSHOT OLDER THAN ID, BOUNDING THE HISTORY OF A ROLLBACK WINDOW
+                void TRIM(U32 ID)
+                {
+                    if(!TRACKER || ID <= TRACKER->BASE_ID)
+                        return;
+
+                    DIRTY_TRACKER& STATE = *TRACKER;
+                    const std::size_t DROP = std::min<std::size_t>(ID - STATE.BASE_ID, STATE.EPOCHS.size());
+                    const std::size_t FIRST = DROP < STATE.EPOCHS.size() ? STATE.EPOCHS[DROP] : STATE.LOG.size();
+                    const std::size_t BYTES = FIRST < STATE.LOG.size() ? STATE.LOG[FIRST].OFFSET : STATE.ARENA.size();
+
+                    STATE.ARENA.erase(STATE.ARENA.begin(), STATE.ARENA.begin() + BYTES);
+                    STATE.LOG.erase(STATE.LOG.begin(), STATE.LOG.begin() + FIRST);
+                    STATE.EPOCHS.erase(STATE.EPOCHS.begin(), STATE.EPOCHS.begin() + DROP);
+
+                    for(typename DIRTY_TRACKER::UNDO_RECORD& RECORD : STATE.LOG) RECORD.OFFSET -= BYTES;
+                    for(std::size_t& EPOCH : STATE.EPOCHS) EPOCH -= FIRST;
+
+                    STATE.BASE_ID += static_cast<U32>(DROP);
+                }
+
+                // NOW PRESUPPOSE THAT THERE IS A WAY IN WHICH WE ARE ABLE
+                // TO MAP AN ARRAY OF MEMORY TO A SPECIFIED RANGE
+                //
+                // THIS WILL TAKE ON THE FORM AND UNDERSTANDING OF THE ABOVE
+                // BUT REQUIRES THE POWER OF TWO UTILITY FOR PROPER VALIDATION
+                // OVER CONTINGUOUS MEMORY
+                //
+                // THE ARRAY MUST ALSO BE ALIGNED TO PAGE_ALIGN SO THAT THE PAGE FLAGS FIT BELOW THE HOST POINTER
+                template<std::size_t ARRAY_SIZE>
+                RESULT<void> MAP_ARRAY(U32 START, U32 END, std::array<U8, ARRAY_SIZE> &ARRAY, bool WRITEABLE)
+                {
+                    static constexpr U32 MASK = ARRAY_SIZE - 1;
+
+                    // THE FAST PATH PRESUPPOSES THAT EVERY OFFSET WITHIN A PAGE LANDS INSIDE THE ARRAY
+                    static_assert((ARRAY_SIZE & MASK) == 0, "MAPPED ARRAYS MUST BE A POWER OF TWO");
+                    static_assert(ARRAY_SIZE >= PAGE_SIZE, "MAPPED ARRAYS MUST SPAN AT LEAST ONE PAGE");
+
+                    return MAP_BUFFER(START, END, ARRAY.data(), ARRAY_SIZE, WRITEABLE);
+                }
+
+                // MAP A RUNTIME-SIZED HOST BUFFER ACROSS A SPECIFIED RANGE
+                // THE BUFFER IS MIRRORED ACROSS THE RANGE SHOULD IT BE SMALLER THAN IT, MUCH LIKE MAP_ARRAY
+                // THE SIZE MUST BE A WHOLE NUMBER OF PAGES AND THE BUFFER ALIGNED TO PAGE_ALIGN
+                //
+                // THE BUS DOESN'T TAKE OWNERSHIP - THE BUFFER MUST OUTLIVE IT'S MAPPING
+                RESULT<void> MAP_BUFFER(U32 START, U32 END, U8* BUFFER, std::size_t SIZE, bool WRITEABLE = true)
+                {
+                    NOODLE_TRY(IN_RANGE("MAP_BUFFER", START, END));
+
+                    if(BUFFER == nullptr)
+                        return MAKE_ERROR(ERROR_CATEGORY::NULL_PTR, FMT_STRING("MAP_BUFFER: NULL BUFFER FOR 0x{:08X}-0x{:08X}"), START, END);
+
+                    if(SIZE == 0 || (SIZE & PAGE_MASK) != 0)
+                        return MAKE_ERROR(ERROR_CATEGORY::INVALID_ARG, FMT_STRING("MAP_BUFFER: SIZE 0x{:X} IS NOT A WHOLE NUMBER OF 0x{:X} BYTE PAGES"), SIZE, PAGE_SIZE);
+
+                    if(reinterpret_cast<PAGE_ENTRY>(BUFFER) & PAGE_FLAG_MASK)
+                        return MAKE_ERROR(ERROR_CATEGORY::INVALID_ARG, FMT_STRING("MAP_BUFFER: BUFFER AT {} IS NOT {}-BYTE ALIGNED"),
+                                          static_cast<const void*>(BUFFER), PAGE_ALIGN);
+
+                    // ASSUME TO BEGIN WITH THAT ALL HANDLERS HAVE BEEN CLEARED
+                    // FROM THERE, ACCOUNT FOR PROPER SIZING
+                    {
+                        auto&& TABLE = PAGES.EDIT();
+                        MAP_PAGES(TABLE, START, END, BUFFER, SIZE, WRITEABLE);
+                    }
+
+                    GENERATION++;
+                    return noodle::err::SUCCESS();
+                }
+
+                // MAP A HOST FILE (A ROM OR DISK IMAGE) STRAIGHT INTO THE BUS WITHOUT COPYING IT
+                // THE FILE IS MMAP'D, SO STARTUP COST DOESN'T SCALE WITH IT'S SIZE AND READ-ONLY IMAGES
+                // ARE SERVED FROM (AND SHARED THROUGH) THE PAGE CACHE ACROSS EVERY INSTANCE
+                //
+                // PRIVATE - WRITES (IF ALLOWED) ARE COPY-ON-WRITE AND NEVER REACH THE FILE
+                // SHARED - WRITES ARE PERSISTED BACK TO THE FILE, FOR BATTERY BACKED SAVES AND THE LIKE
+                //
+                // THE IMAGE IS ROUNDED UP TO A WHOLE NUMBER OF PAGES, WITH EVERYTHING PAST THE END OF THE FILE READING AS ZERO
+                // (THIS TAIL IS NEVER WRITTEN BACK) - THE FILE IS UNMAPPED ONCE NO PAGE REFERS TO IT ANY LONGER
+                RESULT<void> MAP_IMAGE(U32 START, U32 END, const char* PATH, bool WRITEABLE,
+                                       FUJIKO_MAP_MODE MODE = FUJIKO_MAP_MODE::PRIVATE,
+                                       FUJIKO_ADVICE ADVICE = FUJIKO_ADVICE::NORMAL)
+                {
+                    NOODLE_TRY(IN_RANGE("MAP_IMAGE", START, END));
+
+                    auto MAPPING = std::make_unique<FUJIKO_FILE_MAPPING>();
+                    NOODLE_TRY(MAPPING->OPEN(PATH, PAGE_SIZE, WRITEABLE, MODE, ADVICE));
+
+                    U8* const DATA = MAPPING->DATA();
+                    const std::size_t SIZE = MAPPING->SIZE();
+
+                    {
+                        auto&& TABLE = PAGES.EDIT();
+                        ADOPT(std::shared_ptr<FUJIKO_FILE_MAPPING>(std::move(MAPPING)), DATA, SIZE);
+                        MAP_PAGES(TABLE, START, END, DATA, SIZE, WRITEABLE);
+                        RELEASE(TABLE, reinterpret_cast<std::uintptr_t>(DATA));
+                    }
+
+                    GENERATION++;
+                    return noodle::err::SUCCESS();
+                }
+
+                // RETURN A RANGE OF PAGES BACK TO OPEN BUS
+                RESULT<void> UNMAP(U32 START, U32 END)
+                {
+                    NOODLE_TRY(IN_RANGE("UNMAP", START, END));
+
+                    {
+                        auto&& TABLE = PAGES.EDIT();
+
+                        for(U32 INDEX = START >> PAGE_BITS; INDEX <= (END >> PAGE_BITS); INDEX++)
+                            REPOINT(TABLE, INDEX, PAGE_UNMAPPED);
+
+                        if(!WATCHES.empty())
+                            RETRAP(TABLE, START >> PAGE_BITS, END >> PAGE_BITS);
+                    }
+
+                    GENERATION++;
+                    return noodle::err::SUCCESS();
+                }
+
+                // MAP A DEVICE ACROSS A SPECIFIED RANGE
+                // EACH HANDLER IS REGISTERED INTO THE SLOTS MATCHING IT'S WIDTH THROUGH HANDLER_ASSIGN,
+                // ANY WIDTH NOT PROVIDED READS AS OPEN BUS AND DROPS IT'S WRITES
+                //
+                // PAGES THE RANGE COVERS WHOLE POINT STRAIGHT AT THE HANDLER RECORD - A PAGE IT ONLY PARTLY COVERS
+                // IS SPLIT, WITH THE DEVICE LAID OVER WHATEVER WAS MAPPED THERE BEFORE. THE RANGE MUST THEREFORE
+                // START AND END ON A SPLIT_SIZE BOUNDARY
+                //
+                // THIS IS A CHANGE OF CONTRACT - MAP_HANDLER USED TO RETURN NOTHING AND ROUND ANY RANGE OUT TO WHOLE PAGES,
+                // WHEREAS AN UNALIGNED RANGE IS NOW REJECTED RATHER THAN ROUNDED, AND THE RESULT MUST BE CHECKED (OR REPORTED).
+                // A RANGE OF WHOLE PAGES MAPS EXACTLY AS IT ALWAYS DID
+                template<typename... HANDLERS>
+                RESULT<void> MAP_HANDLER(U32 START, U32 END, void* CTX, const HANDLERS&... HANDLE)
+                {
+                    static_assert((FUJIKO_BUS_HANDLER<HANDLERS> && ...), "MAP_HANDLER EXPECTS FUJIKO_HANDLER ARGUMENTS");
+
+                    NOODLE_TRY(SPLIT_ALIGNED("MAP_HANDLER", START, END));
+
+                    auto DEVICE = std::make_unique<MEMORY_HANDLERS>();
+                    DEVICE->CTX = CTX;
+                    (HANDLER_ASSIGN<HANDLERS>::FUJIKO_ASSIGN(*DEVICE, HANDLE), ...);
+
+                    // A PAGE WHICH CANNOT BE SPLIT ANY FURTHER DOESN'T STOP THE REST OF THE RANGE BEING MAPPED
+                    RESULT<void> MAPPED = noodle::err::SUCCESS();
+
+                    {
+                        auto&& TABLE = PAGES.EDIT();
+                        const MEMORY_HANDLERS* RECORD = ADOPT(std::move(DEVICE));
+                        const PAGE_ENTRY ENTRY = reinterpret_cast<PAGE_ENTRY>(RECORD) | PAGE_MMIO;
+                        const SPLIT_REGION REGION{ 0, RECORD, false, false, reinterpret_cast<std::uintptr_t>(RECORD) };
+
+                        for(U32 INDEX = START >> PAGE_BITS; INDEX <= (END >> PAGE_BITS); INDEX++)
+                        {
+                            const U32 FIRST = std::max(START, INDEX << PAGE_BITS) & PAGE_MASK;
+                            const U32 LAST = std::min(END, (INDEX << PAGE_BITS) | PAGE_MASK) & PAGE_MASK;
+
+                            if(FIRST == 0 && LAST == PAGE_MASK)
+                                REPOINT(TABLE, INDEX, ENTRY);
+                            else
+                            {
+                                const RESULT<void> LAID = OVERLAY(TABLE, INDEX, FIRST, LAST, REGION);
+                                if(!LAID && MAPPED) MAPPED = LAID;
+                            }
+                        }
+
+                        if(!WATCHES.empty())
+                            RETRAP(TABLE, START >> PAGE_BITS, END >> PAGE_BITS);
+
+                        // HAND BACK THE MAPPING'S OWN USE - A RECORD NO PAGE TOOK IS FREED RIGHT AWAY
+                        RELEASE(TABLE, reinterpret_cast<std::uintptr_t>(RECORD));
+                    }
+
+                    GENERATION++;
+                    return MAPPED;
+                }
+
+                // MAP HOST MEMORY OF ANY SIZE OR ALIGNMENT ACROSS A RANGE, SUCH AS A SMALL SRAM BESIDE A DEVICE'S REGISTERS
+                // PAGES IT COVERS WHOLE AND WHOSE HOST MEMORY IS PAGE_ALIGN ALIGNED BECOME ORDINARY RAM PAGES,
+                // ANYTHING ELSE IS LAID OVER A SPLIT PAGE - THE SAME SPLIT_SIZE BOUNDARIES APPLY AS FOR MAP_HANDLER
+                //
+                // RAM WITHIN A SPLIT PAGE IS DIRTY TRACKED A LINE AT A TIME, BUT NEVER CACHED BY A TLB
+                RESULT<void> MAP_REGION(U32 START, U32 END, U8* HOST, bool WRITEABLE = true)
+                {
+                    if(HOST == nullptr)
+                        return MAKE_ERROR(ERROR_CATEGORY::NULL_PTR, FMT_STRING("MAP_REGION: NULL HOST MEMORY FOR 0x{:08X}-0x{:08X}"), START, END);
+
+                    NOODLE_TRY(SPLIT_ALIGNED("MAP_REGION", START, END));
+
+                    const PAGE_ENTRY FLAGS = WRITEABLE ? (TRACKER ? PAGE_WRITEABLE | PAGE_TRACKED : PAGE_WRITEABLE) : PAGE_READONLY;
+                    RESULT<void> MAPPED = noodle::err::SUCCESS();
+
+                    {
+                        auto&& TABLE = PAGES.EDIT();
+
+                        for(U32 INDEX = START >> PAGE_BITS; INDEX <= (END >> PAGE_BITS); INDEX++)
+                        {
+                            const U32 FIRST = std::max(START, INDEX << PAGE_BITS) & PAGE_MASK;
+                            const U32 LAST = std::min(END, (INDEX << PAGE_BITS) | PAGE_MASK) & PAGE_MASK;
+
+                            // THE HOST ADDRESS WHICH WOULD LIE AT OFFSET ZERO OF THIS PAGE
+                            const std::uintptr_t ADDEND = reinterpret_cast<std::uintptr_t>(HOST)
+                                                        + (static_cast<std::uintptr_t>(INDEX) << PAGE_BITS) - START;
+
+                            if(FIRST == 0 && LAST == PAGE_MASK && (ADDEND & PAGE_FLAG_MASK) == 0)
+                                REPOINT(TABLE, INDEX, ADDEND | FLAGS);
+                            else
+                            {
+                                const RESULT<void> LAID = OVERLAY(TABLE, INDEX, FIRST, LAST, SPLIT_REGION{ ADDEND, nullptr, true, WRITEABLE });
+                                if(!LAID && MAPPED) MAPPED = LAID;
+                            }
+                        }
+
+                        if(!WATCHES.empty())
+                            RETRAP(TABLE, START >> PAGE_BITS, END >> PAGE_BITS);
+                    }
+
+                    GENERATION++;
+                    return MAPPED;
+                }
+        };
+
+        // THE DEFAULT GEOMETRY - 27 ADDRESS BITS WITH 64KB PAGES
+        using MEMORY_BUS = BASIC_MEMORY_BUS<>;
+
+        // THE SAME GEOMETRY, SHARED BETWEEN CPU THREADS
+        using SHARED_MEMORY_BUS = BASIC_MEMORY_BUS<27, 16, FUJIKO_ENDIAN_NATIVE, FUJIKO_SYNC_SHARED>;
+
+        // CONSTRUCTOR STRUCT ADJACENT FROM THE BASELINE FUNCTIONALITY
+        // TO BE ABLE TO CREATE METHODS
+        struct MEMORY
+        {
+            MEMORY();
+            void RESET(bool MODE);
+            void MAP_MEMORY(MEMORY_BUS& BUS);
+        };
+
+        alignas(64) inline std::array<U8, 0x10000> MEMORY_ARRAY;
+    }
+}
+
+#endif
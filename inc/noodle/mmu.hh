@@ -0,0 +1,483 @@
+// COPYRIGHT (C) HARRY CLARK 2025
+// A LIGHTWEIGHT IMPLEMENTATION OF COMMON UTILITIES
+
+// THIS FILE PERTAINS TOWARDS THE ADDRESS TRANSLATION STAGE WHICH SITS IN FRONT OF THE MEMORY BUS
+// MODELLED AFTER THE MOTOROLA 68851 PMMU - A CONFIGURABLE MULTI-LEVEL TABLE WALK OVER GUEST MEMORY
+// WITH THE RESULTS HELD IN A 64-ENTRY FULLY ASSOCIATIVE ADDRESS TRANSLATION CACHE (ATC)
+//
+// THE FOLLOWING IS SUPPORTED:
+//
+// TC - ENABLE, SRE, FCL, PS, IS AND TIA-TID
+// CRP/SRP - SHORT (4 BYTE) AND LONG (8 BYTE) DESCRIPTOR TABLES, AS WELL AS EARLY TERMINATION
+// DESCRIPTORS - WRITE PROTECT, SUPERVISOR ONLY (LONG FORMAT), USED AND MODIFIED UPDATES
+// ATC - FLUSH ALL (PFLUSHA), FLUSH BY FUNCTION CODE AND MASK, FLUSH BY FUNCTION CODE AND ADDRESS
+//
+// LIMIT CHECKS AND INDIRECT DESCRIPTORS ARE NOT MODELLED - AN INDIRECT DESCRIPTOR IS TREATED AS INVALID
+//
+// FAULTS ARE REPORTED AS VALUES, LEAVING IT UP TO THE CALLER TO RAISE THE RELEVANT BUS ERROR -
+// EITHER AS A BARE MMU_FAULT, OR THROUGH TRY_READ AND TRY_WRITE AS A RESULT
+
+#ifndef MMU_HH
+#define MMU_HH
+
+// NESTED INCLUDES
+
+#include <noodle/memory.hh>
+
+// SYSTEM INCLUDES
+
+#include <array>
+#include <cstring>
+
+namespace fujiko
+{
+    namespace memory
+    {
+        enum class MMU_FAULT : U8
+        {
+            NONE = 0,
+            INVALID,
+            WRITE_PROTECT,
+            SUPERVISOR,
+            CONFIG
+        };
+
+        static constexpr const char* MMU_FAULT_NAMES[] = { "NONE", "INVALID", "WRITE PROTECT", "SUPERVISOR", "CONFIGURATION" };
+
+        // THE SAME FAULT AS AN ERROR VALUE, WITH THE FAULT ITSELF AS IT'S CODE FOR THE CALLER TO DISPATCH ON
+        static NOODLE_NO_INLINE noodle::err::ERROR_VALUE MMU_ERROR(MMU_FAULT FAULT, U32 LOGICAL)
+        {
+            const ERROR_CATEGORY CAT = FAULT == MMU_FAULT::INVALID ? ERROR_CATEGORY::OOB
+                                     : FAULT == MMU_FAULT::CONFIG ? ERROR_CATEGORY::INVALID_ARG
+                                     : ERROR_CATEGORY::RUNTIME_ERR;
+
+            return noodle::err::MAKE_ERROR(CAT, FMT_STRING("MMU: {} FAULT AT 0x{:08X}"), MMU_FAULT_NAMES[static_cast<U8>(FAULT)], LOGICAL)
+                .WITH_CODE(static_cast<U64>(FAULT));
+        }
+
+        // THE RESULT OF A SINGLE TRANSLATION - THE PHYSICAL ADDRESS IS ONLY MEANINGFUL WITHOUT A FAULT
+        struct MMU_TRANSLATION
+        {
+            U32 PHYSICAL = 0;
+            MMU_FAULT FAULT = MMU_FAULT::NONE;
+        };
+
+        // FUNCTION CODES AS PRESENTED BY THE CPU ON EACH ACCESS
+        namespace fc
+        {
+            static constexpr U8 USER_DATA = 1;
+            static constexpr U8 USER_PROGRAM = 2;
+            static constexpr U8 SUPERVISOR_DATA = 5;
+            static constexpr U8 SUPERVISOR_PROGRAM = 6;
+            static constexpr U8 CPU_SPACE = 7;
+        }
+
+        template<typename BUS>
+        class MMU_68851
+        {
+            public:
+                static constexpr U32 ATC_ENTRIES = 64;
+
+                // DESCRIPTOR FIELDS - SHARED BETWEEN THE SHORT FORMAT AND THE FIRST WORD OF THE LONG FORMAT
+                static constexpr U32 DESC_DT_MASK = 0x3;
+                static constexpr U32 DESC_WP = 1U << 2;
+                static constexpr U32 DESC_U = 1U << 3;
+                static constexpr U32 DESC_M = 1U << 4;
+                static constexpr U32 DESC_S = 1U << 8;
+
+                static constexpr U32 DT_INVALID = 0;
+                static constexpr U32 DT_PAGE = 1;
+                static constexpr U32 DT_SHORT = 2;
+                static constexpr U32 DT_LONG = 3;
+
+                explicit MMU_68851(BUS& MEMORY) : MEMORY(MEMORY)
+                {
+                    FLUSH();
+                }
+
+                // LOAD THE TRANSLATION CONTROL REGISTER
+                // A CONFIGURATION WHOSE FIELDS DON'T SUM TO 32 BITS IS REJECTED BEFORE ANYTHING IS ASSIGNED,
+                // LEAVING THE PREVIOUS CONFIGURATION (AND THE ATC) EXACTLY AS THEY WERE
+                MMU_FAULT SET_TC(U32 VALUE)
+                {
+                    const bool ENABLE = (VALUE & (1U << 31)) != 0;
+                    const U32 NEW_PAGE_BITS = (VALUE >> 20) & 0xF;
+                    const U32 NEW_INITIAL_SHIFT = (VALUE >> 16) & 0xF;
+
+                    std::array<U32, 4> NEW_LEVEL_BITS{};
+                    U32 NEW_LEVEL_COUNT = 0;
+                    U32 TOTAL = NEW_PAGE_BITS + NEW_INITIAL_SHIFT;
+
+                    for(U32 LEVEL = 0; LEVEL < 4; LEVEL++)
+                    {
+                        const U32 BITS = (VALUE >> (12 - (LEVEL * 4))) & 0xF;
+                        if(BITS == 0) break;
+
+                        NEW_LEVEL_BITS[NEW_LEVEL_COUNT++] = BITS;
+                        TOTAL += BITS;
+                    }
+
+                    if(ENABLE && (NEW_PAGE_BITS < 8 || TOTAL != 32))
+                        return MMU_FAULT::CONFIG;
+
+                    TC = VALUE;
+                    ENABLED = ENABLE;
+                    FLUSH();
+
+                    if(!ENABLE)
+                        return MMU_FAULT::NONE;
+
+                    PAGE_BITS = NEW_PAGE_BITS;
+                    INITIAL_SHIFT = NEW_INITIAL_SHIFT;
+                    LEVEL_BITS = NEW_LEVEL_BITS;
+                    LEVEL_COUNT = NEW_LEVEL_COUNT;
+                    PAGE_OFFSET = (1U << PAGE_BITS) - 1;
+                    return MMU_FAULT::NONE;
+                }
+
+                // ROOT POINTERS ARE 64-BIT - THE UPPER WORD CARRIES THE DESCRIPTOR TYPE, THE LOWER THE TABLE ADDRESS
+                void SET_CRP(U32 UPPER, U32 LOWER) { CRP_UPPER = UPPER; CRP_LOWER = LOWER; FLUSH(); }
+                void SET_SRP(U32 UPPER, U32 LOWER) { SRP_UPPER = UPPER; SRP_LOWER = LOWER; FLUSH(); }
+
+                U32 GET_TC() const { return TC; }
+
+                // TRANSLATE A LOGICAL ADDRESS FOR A GIVEN FUNCTION CODE
+                // THE ATC HIT PATH IS A SINGLE TAG COMPARE AGAINST THE MOST RECENTLY USED ENTRY AND A FLAG TEST -
+                // EVERYTHING ELSE (A SCAN OF THE ATC, THE TABLE WALK AND ANY FAULT) IS OUT OF LINE
+                NOODLE_FORCE_INLINE MMU_TRANSLATION TRANSLATE(U32 LOGICAL, U8 FC, bool WRITE)
+                {
+                    if(NOODLE_UNLIKELY(!ENABLED))
+                        return MMU_TRANSLATION{ LOGICAL, MMU_FAULT::NONE };
+
+                    const U32 TAG = MAKE_TAG(LOGICAL, FC);
+                    const U32 SLOT = LAST;
+
+                    if(NOODLE_LIKELY(TAGS[SLOT] == TAG && !(FLAGS[SLOT] & DENY_MASK(FC, WRITE))))
+                        return MMU_TRANSLATION{ FRAMES[SLOT] | (LOGICAL & PAGE_OFFSET), MMU_FAULT::NONE };
+
+                    return TRANSLATE_SLOW(LOGICAL, FC, WRITE, TAG);
+                }
+
+                // TRANSLATED ACCESSES - THE FAULT IS RETURNED AND THE VALUE IS ONLY TOUCHED ON SUCCESS
+                // ACCESSES STRADDLING A LOGICAL PAGE ARE TRANSLATED ONE BYTE AT A TIME
+                template<typename T>
+                NOODLE_FORCE_INLINE MMU_FAULT READ(U32 LOGICAL, U8 FC, T& VALUE)
+                {
+                    if(NOODLE_UNLIKELY(((LOGICAL & PAGE_OFFSET) + sizeof(T) - 1) > PAGE_OFFSET && ENABLED))
+                        return SPLIT_READ(LOGICAL, FC, VALUE);
+
+                    const MMU_TRANSLATION RESULT = TRANSLATE(LOGICAL, FC, false);
+                    if(RESULT.FAULT == MMU_FAULT::NONE)
+                        VALUE = MEMORY.template READ<T>(RESULT.PHYSICAL);
+
+                    return RESULT.FAULT;
+                }
+
+                template<typename T>
+                NOODLE_FORCE_INLINE MMU_FAULT WRITE(U32 LOGICAL, U8 FC, T VALUE)
+                {
+                    if(NOODLE_UNLIKELY(((LOGICAL & PAGE_OFFSET) + sizeof(T) - 1) > PAGE_OFFSET && ENABLED))
+                        return SPLIT_WRITE(LOGICAL, FC, VALUE);
+
+                    const MMU_TRANSLATION RESULT = TRANSLATE(LOGICAL, FC, true);
+                    if(RESULT.FAULT == MMU_FAULT::NONE)
+                        MEMORY.template WRITE<T>(RESULT.PHYSICAL, VALUE);
+
+                    return RESULT.FAULT;
+                }
+
+                // AS ABOVE, WITH THE FAULT RETURNED AS A RESULT FOR CALLERS PROPAGATING IT WITH NOODLE_TRY
+                template<typename T>
+                NOODLE_FORCE_INLINE RESULT<T> TRY_READ(U32 LOGICAL, U8 FC)
+                {
+                    T VALUE = 0;
+                    const MMU_FAULT FAULT = READ<T>(LOGICAL, FC, VALUE);
+
+                    if(NOODLE_UNLIKELY(FAULT != MMU_FAULT::NONE))
+                        return MMU_ERROR(FAULT, LOGICAL);
+
+                    return VALUE;
+                }
+
+                template<typename T>
+                NOODLE_FORCE_INLINE RESULT<void> TRY_WRITE(U32 LOGICAL, U8 FC, T VALUE)
+                {
+                    const MMU_FAULT FAULT = WRITE<T>(LOGICAL, FC, VALUE);
+
+                    if(NOODLE_UNLIKELY(FAULT != MMU_FAULT::NONE))
+                        return MMU_ERROR(FAULT, LOGICAL);
+
+                    return noodle::err::SUCCESS();
+                }
+
+                // PFLUSHA
+                void FLUSH()
+                {
+                    TAGS.fill(INVALID_TAG);
+                    LAST = 0;
+                    NEXT = 0;
+                }
+
+                // PFLUSH FC, MASK - DISCARD EVERY ENTRY WHOSE FUNCTION CODE MATCHES UNDER THE MASK
+                void FLUSH_FC(U8 FC, U8 MASK)
+                {
+                    for(U32 SLOT = 0; SLOT < ATC_ENTRIES; SLOT++)
+                    {
+                        if(TAGS[SLOT] == INVALID_TAG) continue;
+
+                        const U8 ENTRY_FC = (TAGS[SLOT] >> 1) & 0x7;
+                        if((ENTRY_FC & MASK) == (FC & MASK))
+                            TAGS[SLOT] = INVALID_TAG;
+                    }
+                }
+
+                // PFLUSH FC, MASK, <EA> - AS ABOVE, BUT ONLY FOR THE PAGE CONTAINING THE LOGICAL ADDRESS
+                void FLUSH_PAGE(U8 FC, U8 MASK, U32 LOGICAL)
+                {
+                    const U32 PAGE = MAKE_TAG(LOGICAL, 0) >> 4;
+
+                    for(U32 SLOT = 0; SLOT < ATC_ENTRIES; SLOT++)
+                    {
+                        if(TAGS[SLOT] == INVALID_TAG || (TAGS[SLOT] >> 4) != PAGE) continue;
+
+                        const U8 ENTRY_FC = (TAGS[SLOT] >> 1) & 0x7;
+                        if((ENTRY_FC & MASK) == (FC & MASK))
+                            TAGS[SLOT] = INVALID_TAG;
+                    }
+                }
+
+                // NUMBER OF TABLE WALKS PERFORMED
+                U64 WALKS = 0;
+
+            private:
+                static constexpr U32 INVALID_TAG = 0;
+
+                // CACHED PERMISSIONS FOR AN ATC ENTRY
+                // NOT_MODIFIED FORCES THE FIRST WRITE BACK THROUGH THE WALK SO THAT THE M BIT GETS SET
+                static constexpr U8 ATC_SUPERVISOR = 1U << 0;
+                static constexpr U8 ATC_WRITE_PROTECT = 1U << 1;
+                static constexpr U8 ATC_NOT_MODIFIED = 1U << 2;
+
+                // EVERY TAG HAS IT'S LOW BIT SET, SO THAT A ZERO TAG CAN NEVER MATCH
+                NOODLE_FORCE_INLINE U32 MAKE_TAG(U32 LOGICAL, U8 FC) const
+                {
+                    const U32 PAGE = (LOGICAL << INITIAL_SHIFT) >> (INITIAL_SHIFT + PAGE_BITS);
+                    return (PAGE << 4) | ((FC & 0x7U) << 1) | 1U;
+                }
+
+                static NOODLE_FORCE_INLINE U8 DENY_MASK(U8 FC, bool WRITE)
+                {
+                    return static_cast<U8>(((FC & 0x4) ? 0 : ATC_SUPERVISOR)
+                                           | (WRITE ? (ATC_WRITE_PROTECT | ATC_NOT_MODIFIED) : 0));
+                }
+
+                // SCAN THE ATC, FALLING BACK TO A TABLE WALK ON A MISS OR WHEN THE CACHED PERMISSIONS DENY THE ACCESS
+                NOODLE_NO_INLINE MMU_TRANSLATION TRANSLATE_SLOW(U32 LOGICAL, U8 FC, bool WRITE, U32 TAG)
+                {
+                    U32 SLOT = ATC_ENTRIES;
+
+                    for(U32 INDEX = 0; INDEX < ATC_ENTRIES; INDEX++)
+                    {
+                        if(TAGS[INDEX] == TAG)
+                        {
+                            SLOT = INDEX;
+                            break;
+                        }
+                    }
+
+                    if(SLOT != ATC_ENTRIES)
+                    {
+                        const U8 DENIED = FLAGS[SLOT] & DENY_MASK(FC, WRITE);
+
+                        if(DENIED & ATC_SUPERVISOR)
+                            return MMU_TRANSLATION{ 0, MMU_FAULT::SUPERVISOR };
+
+                        if(DENIED & ATC_WRITE_PROTECT)
+                            return MMU_TRANSLATION{ 0, MMU_FAULT::WRITE_PROTECT };
+
+                        if(!DENIED)
+                        {
+                            LAST = SLOT;
+                            return MMU_TRANSLATION{ FRAMES[SLOT] | (LOGICAL & PAGE_OFFSET), MMU_FAULT::NONE };
+                        }
+
+                        // ONLY THE MODIFIED BIT IS OUTSTANDING - RE-WALK IN PLACE
+                        TAGS[SLOT] = INVALID_TAG;
+                    }
+
+                    WALKS++;
+                    return WALK(LOGICAL, FC, WRITE, TAG);
+                }
+
+                // WALK THE TRANSLATION TABLES FROM THE RELEVANT ROOT POINTER
+                MMU_TRANSLATION WALK(U32 LOGICAL, U8 FC, bool WRITE, U32 TAG)
+                {
+                    const bool SUPERVISOR = (FC & 0x4) != 0;
+                    const bool USE_SRP = SUPERVISOR && (TC & (1U << 25));
+
+                    U32 DT = (USE_SRP ? SRP_UPPER : CRP_UPPER) & DESC_DT_MASK;
+                    U32 TABLE = (USE_SRP ? SRP_LOWER : CRP_LOWER) & ~0xFU;
+
+                    bool WP = false;
+                    bool S = false;
+
+                    // A PAGE DESCRIPTOR IN THE ROOT POINTER MEANS NO TRANSLATION AT ALL
+                    if(DT == DT_PAGE)
+                        return FILL(LOGICAL, TAG, LOGICAL & ~PAGE_OFFSET, false, false, true);
+
+                    // THE LOGICAL ADDRESS WITH THE INITIAL SHIFT STRIPPED OFF, CONSUMED FROM THE TOP DOWN
+                    U32 REMAINING = LOGICAL << INITIAL_SHIFT;
+                    U32 CONSUMED = INITIAL_SHIFT;
+
+                    // FUNCTION CODE LOOKUP INSERTS AN ADDITIONAL LEVEL INDEXED BY THE FUNCTION CODE
+                    const bool FCL = (TC & (1U << 24)) != 0;
+
+                    for(U32 LEVEL = 0; LEVEL < LEVEL_COUNT + (FCL ? 1 : 0); LEVEL++)
+                    {
+                        if(DT == DT_INVALID)
+                            return MMU_TRANSLATION{ 0, MMU_FAULT::INVALID };
+
+                        U32 INDEX;
+
+                        if(FCL && LEVEL == 0)
+                            INDEX = FC & 0x7;
+                        else
+                        {
+                            const U32 BITS = LEVEL_BITS[LEVEL - (FCL ? 1 : 0)];
+                            INDEX = REMAINING >> (32 - BITS);
+                            REMAINING <<= BITS;
+                            CONSUMED += BITS;
+                        }
+
+                        const bool LONG = (DT == DT_LONG);
+                        const U32 ADDRESS = TABLE + INDEX * (LONG ? 8 : 4);
+
+                        U32 UPPER = MEMORY.template READ<U32>(ADDRESS);
+                        const U32 LOWER = LONG ? MEMORY.template READ<U32>(ADDRESS + 4) : 0;
+
+                        DT = UPPER & DESC_DT_MASK;
+                        if(DT == DT_INVALID)
+                            return MMU_TRANSLATION{ 0, MMU_FAULT::INVALID };
+
+                        WP |= (UPPER & DESC_WP) != 0;
+                        S |= LONG && (UPPER & DESC_S);
+
+                        if(DT == DT_PAGE)
+                        {
+                            // A FAULTING ACCESS NEVER REACHES THE PAGE, SO LEAVES IT'S USED AND MODIFIED BITS ALONE
+                            if(S && !SUPERVISOR)
+                                return MMU_TRANSLATION{ 0, MMU_FAULT::SUPERVISOR };
+
+                            if(WP && WRITE)
+                                return MMU_TRANSLATION{ 0, MMU_FAULT::WRITE_PROTECT };
+
+                            UPPER = UPDATE_DESCRIPTOR(ADDRESS, UPPER, DESC_U | (WRITE ? DESC_M : 0));
+
+                            // EARLY TERMINATION MAPS EVERYTHING BELOW THE CONSUMED BITS STRAIGHT THROUGH
+                            const U32 BASE = LONG ? LOWER : (UPPER & ~0xFFU);
+                            const U32 BELOW = (CONSUMED >= 32) ? 0 : (0xFFFFFFFFU >> CONSUMED);
+                            const U32 FRAME = ((BASE & ~BELOW) | (LOGICAL & BELOW)) & ~PAGE_OFFSET;
+
+                            return FILL(LOGICAL, TAG, FRAME, S, WP, (UPPER & DESC_M) != 0);
+                        }
+
+                        // A TABLE DESCRIPTOR IS USED AS SOON AS THE WALK PASSES THROUGH IT
+                        UPPER = UPDATE_DESCRIPTOR(ADDRESS, UPPER, DESC_U);
+                        TABLE = (LONG ? LOWER : UPPER) & ~0xFU;
+                    }
+
+                    // RAN OUT OF LEVELS WITHOUT REACHING A PAGE DESCRIPTOR (INDIRECT)
+                    return MMU_TRANSLATION{ 0, MMU_FAULT::INVALID };
+                }
+
+                // SET HISTORY BITS IN A DESCRIPTOR, ONLY WRITING IT BACK WHEN ONE WAS CLEAR
+                U32 UPDATE_DESCRIPTOR(U32 ADDRESS, U32 UPPER, U32 BITS)
+                {
+                    if((UPPER & BITS) != BITS)
+                    {
+                        UPPER |= BITS;
+                        MEMORY.template WRITE<U32>(ADDRESS, UPPER);
+                    }
+
+                    return UPPER;
+                }
+
+                // INSERT A TRANSLATION INTO THE ATC, REPLACING ENTRIES IN ROUND ROBIN ORDER
+                MMU_TRANSLATION FILL(U32 LOGICAL, U32 TAG, U32 FRAME, bool S, bool WP, bool MODIFIED)
+                {
+                    const U32 SLOT = NEXT;
+                    NEXT = (NEXT + 1) % ATC_ENTRIES;
+
+                    TAGS[SLOT] = TAG;
+                    FRAMES[SLOT] = FRAME;
+                    FLAGS[SLOT] = static_cast<U8>((S ? ATC_SUPERVISOR : 0) | (WP ? ATC_WRITE_PROTECT : 0)
+                                                  | (MODIFIED ? 0 : ATC_NOT_MODIFIED));
+                    LAST = SLOT;
+
+                    return MMU_TRANSLATION{ FRAME | (LOGICAL & PAGE_OFFSET), MMU_FAULT::NONE };
+                }
+
+                template<typename T>
+                NOODLE_NO_INLINE MMU_FAULT SPLIT_READ(U32 LOGICAL, U8 FC, T& VALUE)
+                {
+                    U8 BYTES[sizeof(T)];
+
+                    for(U32 INDEX = 0; INDEX < sizeof(T); INDEX++)
+                    {
+                        const MMU_FAULT FAULT = READ<U8>(LOGICAL + INDEX, FC, BYTES[INDEX]);
+                        if(FAULT != MMU_FAULT::NONE) return FAULT;
+                    }
+
+                    T RAW;
+                    std::memcpy(&RAW, BYTES, sizeof(T));
+                    VALUE = BUS::ENDIAN_POLICY::CONVERT(RAW);
+                    return MMU_FAULT::NONE;
+                }
+
+                // EVERY BYTE IS TRANSLATED BEFORE ANY ARE WRITTEN, SO A FAULT ON THE SECOND PAGE LEAVES MEMORY UNTOUCHED
+                template<typename T>
+                NOODLE_NO_INLINE MMU_FAULT SPLIT_WRITE(U32 LOGICAL, U8 FC, T VALUE)
+                {
+                    U32 PHYSICAL[sizeof(T)];
+
+                    for(U32 INDEX = 0; INDEX < sizeof(T); INDEX++)
+                    {
+                        const MMU_TRANSLATION RESULT = TRANSLATE(LOGICAL + INDEX, FC, true);
+                        if(RESULT.FAULT != MMU_FAULT::NONE) return RESULT.FAULT;
+                        PHYSICAL[INDEX] = RESULT.PHYSICAL;
+                    }
+
+                    U8 BYTES[sizeof(T)];
+                    VALUE = BUS::ENDIAN_POLICY::CONVERT(VALUE);
+                    std::memcpy(BYTES, &VALUE, sizeof(T));
+
+                    for(U32 INDEX = 0; INDEX < sizeof(T); INDEX++)
+                        MEMORY.template WRITE<U8>(PHYSICAL[INDEX], BYTES[INDEX]);
+
+                    return MMU_FAULT::NONE;
+                }
+
+                BUS& MEMORY;
+
+                U32 TC = 0;
+                U32 CRP_UPPER = 0, CRP_LOWER = 0;
+                U32 SRP_UPPER = 0, SRP_LOWER = 0;
+
+                bool ENABLED = false;
+                U32 PAGE_BITS = 12;
+                U32 PAGE_OFFSET = 0xFFF;
+                U32 INITIAL_SHIFT = 0;
+                U32 LEVEL_COUNT = 0;
+                std::array<U32, 4> LEVEL_BITS{};
+
+                // THE ATC IS KEPT AS A STRUCTURE OF ARRAYS SO THAT A SCAN ONLY TOUCHES THE TAGS
+                U32 LAST = 0;
+                U32 NEXT = 0;
+                alignas(64) std::array<U32, ATC_ENTRIES> TAGS;
+                alignas(64) std::array<U32, ATC_ENTRIES> FRAMES{};
+                alignas(64) std::array<U8, ATC_ENTRIES> FLAGS{};
+        };
+    }
+}
+
+#endif
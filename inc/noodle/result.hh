@@ -0,0 +1,348 @@
+// COPYRIGHT (C) HARRY CLARK 2025
+// A LIGHTWEIGHT IMPLEMENTATION OF COMMON UTILITIES
+
+// THIS FILE PERTAINS TOWARDS RETURNING ERRORS AS VALUES RATHER THAN PRINTING THEM WHERE THEY HAPPEN
+// A RESULT<T> HOLDS EITHER A VALUE OR AN ERROR_VALUE - THE SAME CATEGORY AND SEVERITY AS THE NOODLE_* MACROS,
+// PLUS A MESSAGE WHICH IS ONLY EVER FORMATTED SHOULD THE CALLER ASK FOR IT
+//
+// AN ERROR IS IT'S CATEGORY, SEVERITY AND CODE, PLUS A COUNTED REFERENCE TO IT'S DETAIL (FORMAT STRING AND A COPY OF
+// THE ARGUMENTS) - ALLOCATED ONLY WHEN AN ERROR WITH ARGUMENTS IS RAISED. SO A RESULT OF A WORD SIZED VALUE IS THREE WORDS,
+// AND A SUCCESS ONLY WRITES IT'S VALUE AND A NULL POINTER. THE MESSAGE ISN'T FORMATTED UNTIL IT'S ASKED FOR,
+// AND A MESSAGE WHICH FAILS TO FORMAT COMES BACK AS A MARKER RATHER THAN AN EXCEPTION
+
+#ifndef RESULT_HH
+#define RESULT_HH
+
+// NESTED INCLUDES
+
+#include <common.hh>
+#include <noodle/error.hh>
+
+// SYSTEM INCLUDES
+
+#include <atomic>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace noodle
+{
+    namespace err
+    {
+        template<typename T, bool TRIVIAL>
+        struct RESULT_STORAGE;
+
+        template<typename T>
+        class RESULT;
+
+        // WHAT AN ERROR SAYS - IT'S FORMAT STRING AND A COPY OF IT'S ARGUMENTS, SHARED BY EVERY COPY OF THE ERROR
+        // AND FREED WITH THE LAST. A DETAIL WITHOUT DESTROY IS STATIC, AND NEVER COUNTED
+        struct ERROR_DETAIL
+        {
+            fmt::string_view FORMAT;
+            std::string (*RENDER)(const ERROR_DETAIL&);
+            void (*DESTROY)(const ERROR_DETAIL*);
+            mutable std::atomic<U32> USES{1};
+        };
+
+        template<typename... ARGS>
+        struct ERROR_ARGUMENTS : ERROR_DETAIL
+        {
+            std::tuple<ARGS...> VALUES;
+        };
+
+        // A COUNTED REFERENCE TO A DETAIL - NULL WHEN THERE IS NO ERROR, SO A SUCCESS IS COPIED WITHOUT TOUCHING A COUNT
+        class ERROR_DETAIL_REF
+        {
+            public:
+                ERROR_DETAIL_REF() = default;
+                explicit ERROR_DETAIL_REF(const ERROR_DETAIL* DETAIL) : DETAIL(DETAIL) {}
+
+                ERROR_DETAIL_REF(const ERROR_DETAIL_REF& OTHER) : DETAIL(OTHER.DETAIL)
+                {
+                    if(DETAIL && DETAIL->DESTROY)
+                        DETAIL->USES.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                ERROR_DETAIL_REF(ERROR_DETAIL_REF&& OTHER) noexcept : DETAIL(std::exchange(OTHER.DETAIL, nullptr)) {}
+
+                ERROR_DETAIL_REF& operator=(ERROR_DETAIL_REF OTHER) noexcept
+                {
+                    std::swap(DETAIL, OTHER.DETAIL);
+                    return *this;
+                }
+
+                ~ERROR_DETAIL_REF()
+                {
+                    if(DETAIL && DETAIL->DESTROY && DETAIL->USES.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                        DETAIL->DESTROY(DETAIL);
+                }
+
+                const ERROR_DETAIL& operator*() const { return *DETAIL; }
+                const ERROR_DETAIL* operator->() const { return DETAIL; }
+                explicit operator bool() const { return DETAIL != nullptr; }
+
+            private:
+                const ERROR_DETAIL* DETAIL = nullptr;
+        };
+
+        // WHAT AN ERROR ARGUMENT IS KEPT AS - A STRING IS COPIED, SO NEED NOT OUTLIVE THE ERROR
+        template<typename T>
+        using ERROR_STORED_T = std::conditional_t<STRING_ARGUMENT<T>, std::string, T>;
+
+        // A DESCRIPTION OF WHAT WENT WRONG, HOW BADLY, AND A DOMAIN SPECIFIC CODE (A FAULTING ADDRESS, AN ERRNO, AN MMU FAULT)
+        //
+        // THE CATEGORY, SEVERITY AND CODE ARE HELD INLINE. THE FORMAT STRING IS CHECKED AGAINST THE ARGUMENTS AT COMPILE TIME,
+        // SO MUST BE GIVEN THROUGH FMT_STRING, AND THE ARGUMENTS ARE COPIED INTO A DETAIL OWNED BY THE ERROR - SO AN ERROR
+        // MAY BE KEPT, OR HANDED TO ANOTHER THREAD, FOR AS LONG AS IT'S NEEDED. AN ERROR WITHOUT ARGUMENTS ALLOCATES NOTHING
+        class ERROR_VALUE
+        {
+            public:
+                // ARRAYS (STRING LITERALS) ARE STORED AS THE POINTERS THEY DECAY TO, BEFORE BEING COPIED AS STRINGS
+                template<typename S, typename... ARGS>
+                static ERROR_VALUE MAKE(ERROR_CATEGORY CAT, ERROR_SEVERITY SEV, const S& FORMAT, const ARGS&... A)
+                {
+                    return PACK<S, std::decay_t<const ARGS>...>(CAT, SEV, FORMAT, A...);
+                }
+
+                ERROR_VALUE WITH_CODE(U64 CODE) const &
+                {
+                    return ERROR_VALUE(DETAIL, CAT, SEV, CODE);
+                }
+
+                ERROR_VALUE WITH_CODE(U64 CODE) &&
+                {
+                    return ERROR_VALUE(std::move(DETAIL), CAT, SEV, CODE);
+                }
+
+                ERROR_CATEGORY CATEGORY() const { return CAT; }
+                ERROR_SEVERITY SEVERITY() const { return SEV; }
+                U64 CODE() const { return CODE_VALUE; }
+
+                // THE ONLY POINT AT WHICH THE MESSAGE IS FORMATTED
+                // AN ARGUMENT WHICH FMT STILL REJECTS AT RUNTIME (A NEGATIVE WIDTH) GIVES A MARKER IN PLACE OF THE MESSAGE
+                std::string MESSAGE() const
+                {
+                    try
+                    {
+                        return DETAIL->RENDER(*DETAIL);
+                    }
+                    catch(const fmt::format_error& ERROR)
+                    {
+                        return fmt::format("<FORMAT ERROR: {}>", ERROR.what());
+                    }
+                }
+
+                // HAND THE ERROR TO THE USUAL LOG, SUBJECT TO THE SAME RUNTIME LEVEL AS THE NOODLE_* MACROS
+                void REPORT() const
+                {
+                    if(LOG_ENABLED(SEV))
+                        NOODLE_PRINT(CAT, SEV, fmt::string_view(MESSAGE()));
+                }
+
+            private:
+                template<typename, bool>
+                friend struct RESULT_STORAGE;
+
+                friend class RESULT<void>;
+
+                ERROR_VALUE() : CODE_VALUE(0), CAT(), SEV() {}
+
+                ERROR_VALUE(ERROR_DETAIL_REF DETAIL, ERROR_CATEGORY CAT, ERROR_SEVERITY SEV, U64 CODE)
+                    : DETAIL(std::move(DETAIL)), CODE_VALUE(CODE), CAT(CAT), SEV(SEV) {}
+
+                template<typename T>
+                static ERROR_STORED_T<T> STORE(const T& VALUE)
+                {
+                    if constexpr (std::is_pointer_v<T> && STRING_ARGUMENT<T>)
+                        return VALUE ? std::string(VALUE) : std::string("(NULL)");
+                    else
+                        return ERROR_STORED_T<T>(VALUE);
+                }
+
+                template<typename S, typename... ARGS>
+                static ERROR_VALUE PACK(ERROR_CATEGORY CAT, ERROR_SEVERITY SEV, const S& FORMAT, const ARGS&... A)
+                {
+                    static_assert(STATIC_FORMAT<S>, "ERROR FORMAT STRINGS MUST BE GIVEN THROUGH FMT_STRING");
+
+                    // FAILS TO COMPILE SHOULD THE FORMAT STRING NOT MATCH THE ARGUMENTS AS THEY ARE STORED
+                    const fmt::format_string<ERROR_STORED_T<ARGS>...> CHECKED(FORMAT);
+
+                    // ONE FOR EVERY CALL SITE, AS EACH FMT_STRING IS A TYPE OF IT'S OWN
+                    if constexpr (sizeof...(ARGS) == 0)
+                    {
+                        static const ERROR_ARGUMENTS<> DETAIL{ { fmt::string_view(CHECKED), &RENDER_ARGS<>, nullptr }, {} };
+                        return ERROR_VALUE(ERROR_DETAIL_REF(&DETAIL), CAT, SEV, 0);
+                    }
+                    else
+                    {
+                        const auto* DETAIL = new ERROR_ARGUMENTS<ERROR_STORED_T<ARGS>...>{
+                            { fmt::string_view(CHECKED), &RENDER_ARGS<ERROR_STORED_T<ARGS>...>, &DESTROY_ARGS<ERROR_STORED_T<ARGS>...> },
+                            { STORE(A)... } };
+
+                        return ERROR_VALUE(ERROR_DETAIL_REF(DETAIL), CAT, SEV, 0);
+                    }
+                }
+
+                template<typename... ARGS>
+                static std::string RENDER_ARGS(const ERROR_DETAIL& DETAIL)
+                {
+                    return std::apply([&DETAIL](const ARGS&... A)
+                    {
+                        return fmt::vformat(DETAIL.FORMAT, fmt::make_format_args(A...));
+                    }, static_cast<const ERROR_ARGUMENTS<ARGS...>&>(DETAIL).VALUES);
+                }
+
+                template<typename... ARGS>
+                static void DESTROY_ARGS(const ERROR_DETAIL* DETAIL)
+                {
+                    delete static_cast<const ERROR_ARGUMENTS<ARGS...>*>(DETAIL);
+                }
+
+                ERROR_DETAIL_REF DETAIL;
+                U64 CODE_VALUE;
+                ERROR_CATEGORY CAT;
+                ERROR_SEVERITY SEV;
+        };
+
+        // SHORTHAND FOR THE COMMON CASE OF A STANDARD ERROR - E.G. MAKE_ERROR(ERROR_CATEGORY::OOB, FMT_STRING("..."), ...)
+        template<typename S, typename... ARGS>
+        static inline ERROR_VALUE MAKE_ERROR(ERROR_CATEGORY CAT, const S& FORMAT, const ARGS&... A)
+        {
+            return ERROR_VALUE::MAKE(CAT, ERROR_SEVERITY::STD_ERROR, FORMAT, A...);
+        }
+
+        template<typename S, typename... ARGS>
+        static inline ERROR_VALUE MAKE_ERROR(ERROR_CATEGORY CAT, ERROR_SEVERITY SEV, const S& FORMAT, const ARGS&... A)
+        {
+            return ERROR_VALUE::MAKE(CAT, SEV, FORMAT, A...);
+        }
+
+        // STORAGE FOR A RESULT - A TRIVIALLY COPYABLE VALUE SHARES IT'S SPACE WITH THE ERROR'S CODE, WITH A NULL DETAIL
+        // MARKING SUCCESS. ANYTHING ELSE KEEPS IT'S VALUE IN AN OPTIONAL BESIDE THE ERROR
+        template<typename T, bool TRIVIAL = std::is_trivially_copyable<T>::value>
+        struct RESULT_STORAGE
+        {
+            RESULT_STORAGE(const T& VALUE) : VALUE(VALUE) {}
+            RESULT_STORAGE(const ERROR_VALUE& ERR) : DETAIL(ERR.DETAIL), CODE(ERR.CODE_VALUE), CAT(ERR.CAT), SEV(ERR.SEV) {}
+            RESULT_STORAGE(ERROR_VALUE&& ERR) : DETAIL(std::move(ERR.DETAIL)), CODE(ERR.CODE_VALUE), CAT(ERR.CAT), SEV(ERR.SEV) {}
+
+            ERROR_DETAIL_REF DETAIL;
+
+            union
+            {
+                T VALUE;
+                U64 CODE;
+            };
+
+            ERROR_CATEGORY CAT{};
+            ERROR_SEVERITY SEV{};
+
+            bool OK() const { return !DETAIL; }
+            ERROR_VALUE ERR() const { return ERROR_VALUE(DETAIL, CAT, SEV, CODE); }
+
+            T& GET() { return VALUE; }
+            const T& GET() const { return VALUE; }
+        };
+
+        template<typename T>
+        struct RESULT_STORAGE<T, false>
+        {
+            RESULT_STORAGE(const T& VALUE) : VALUE(VALUE) {}
+            RESULT_STORAGE(T&& VALUE) : VALUE(std::move(VALUE)) {}
+            RESULT_STORAGE(const ERROR_VALUE& ERR) : FAILURE(ERR) {}
+            RESULT_STORAGE(ERROR_VALUE&& ERR) : FAILURE(std::move(ERR)) {}
+
+            std::optional<T> VALUE;
+            ERROR_VALUE FAILURE;
+
+            bool OK() const { return !FAILURE.DETAIL; }
+            ERROR_VALUE ERR() const { return FAILURE; }
+
+            T& GET() { return *VALUE; }
+            const T& GET() const { return *VALUE; }
+        };
+
+        template<typename T>
+        class [[nodiscard]] RESULT
+        {
+            public:
+                RESULT(const T& VALUE) : STORAGE(VALUE) {}
+                RESULT(T&& VALUE) : STORAGE(std::move(VALUE)) {}
+                RESULT(const ERROR_VALUE& ERR) : STORAGE(ERR) {}
+                RESULT(ERROR_VALUE&& ERR) : STORAGE(std::move(ERR)) {}
+
+                bool OK() const { return STORAGE.OK(); }
+                explicit operator bool() const { return OK(); }
+
+                // ONLY MEANINGFUL ON SUCCESS, AND ONLY ERROR ON FAILURE - NEITHER IS CHECKED
+                T& VALUE() & { return STORAGE.GET(); }
+                const T& VALUE() const & { return STORAGE.GET(); }
+                T&& VALUE() && { return std::move(STORAGE.GET()); }
+
+                ERROR_VALUE ERROR() const { return STORAGE.ERR(); }
+
+                T VALUE_OR(T FALLBACK) const { return OK() ? STORAGE.GET() : FALLBACK; }
+
+                // REPORT A FAILURE THROUGH THE LOG, RETURNING WHETHER THERE WAS A VALUE
+                bool REPORT() const
+                {
+                    if(!OK()) ERROR().REPORT();
+                    return OK();
+                }
+
+            private:
+                RESULT_STORAGE<T> STORAGE;
+        };
+
+        // A RESULT WHICH ONLY EVER SIGNALS SUCCESS OR FAILURE - JUST THE ERROR, WITH A NULL DETAIL ON SUCCESS
+        template<>
+        class [[nodiscard]] RESULT<void>
+        {
+            public:
+                RESULT() = default;
+                RESULT(const ERROR_VALUE& ERR) : ERR(ERR) {}
+                RESULT(ERROR_VALUE&& ERR) : ERR(std::move(ERR)) {}
+
+                bool OK() const { return !ERR.DETAIL; }
+                explicit operator bool() const { return OK(); }
+
+                ERROR_VALUE ERROR() const { return ERR; }
+
+                bool REPORT() const
+                {
+                    if(!OK()) ERROR().REPORT();
+                    return OK();
+                }
+
+            private:
+                ERROR_VALUE ERR;
+        };
+
+        // SUCCESS FOR A RESULT<VOID>, READING BETTER THAN RESULT<VOID>{}
+        static inline RESULT<void> SUCCESS() { return RESULT<void>(); }
+    }
+}
+
+    // PROPAGATE A FAILURE TO THE CALLER, WHICH MUST ITSELF RETURN A RESULT (OF ANY TYPE)
+    #define NOODLE_TRY(EXPR) \
+    do \
+    { \
+        const auto& NOODLE_TRY_RESULT = (EXPR); \
+        if(!NOODLE_TRY_RESULT) \
+            return NOODLE_TRY_RESULT.ERROR(); \
+    } while(0)
+
+    // AS ABOVE, DECLARING VAR FROM THE VALUE ON SUCCESS - E.G. NOODLE_TRY_ASSIGN(U32 PHYSICAL, MMU.TRY_TRANSLATE(...))
+    #define NOODLE_TRY_CONCAT_INNER(A, B) A##B
+    #define NOODLE_TRY_CONCAT(A, B) NOODLE_TRY_CONCAT_INNER(A, B)
+
+    #define NOODLE_TRY_ASSIGN(VAR, EXPR) \
+    auto NOODLE_TRY_CONCAT(NOODLE_TRY_, __LINE__) = (EXPR); \
+    if(!NOODLE_TRY_CONCAT(NOODLE_TRY_, __LINE__)) \
+        return NOODLE_TRY_CONCAT(NOODLE_TRY_, __LINE__).ERROR(); \
+    VAR = std::move(NOODLE_TRY_CONCAT(NOODLE_TRY_, __LINE__)).VALUE()
+
+#endif
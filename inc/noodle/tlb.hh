@@ -0,0 +1,171 @@
+// COPYRIGHT (C) HARRY CLARK 2025
+// A LIGHTWEIGHT IMPLEMENTATION OF COMMON UTILITIES
+
+// THIS FILE PERTAINS TOWARDS A SMALL SOFTWARE TLB WHICH SITS IN FRONT OF THE MEMORY BUS
+// GUEST CODE TENDS TO WALK MEMORY SEQUENTIALLY OR WITH A FIXED STRIDE, SO RATHER THAN RECOMPUTING
+// THE PAGE INDEX AND LOADING THE PAGE ENTRY ON EVERY ACCESS, THE MOST RECENT TRANSLATIONS ARE KEPT
+// IN A DIRECT-MAPPED CACHE OF (PAGE TAG, HOST ADDEND) PAIRS
+//
+// THE ADDEND IS THE HOST POINTER OF THE PAGE MINUS THE GUEST BASE OF THE PAGE,
+// MEANING THAT A HIT IS SIMPLY A LOAD FROM ADDEND + GUEST ADDRESS
+
+#ifndef TLB_HH
+#define TLB_HH
+
+// NESTED INCLUDES
+
+#include <noodle/memory.hh>
+
+// SYSTEM INCLUDES
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+// COUNTING HITS COSTS A LOAD AND STORE ON EVERY HIT, WHICH IS A GOOD SHARE OF WHAT A HIT COSTS -
+// SO IT IS COMPILED OUT UNLESS REQUESTED (SEE THE NOODLE_TLB_STATS BUILD OPTION). MISSES ARE ALWAYS COUNTED,
+// AS THEY ARE ALREADY OFF THE FAST PATH
+
+#ifndef NOODLE_TLB_STATS
+    #define NOODLE_TLB_STATS 0
+#endif
+
+namespace fujiko
+{
+    namespace memory
+    {
+        // READ AND WRITE TRANSLATIONS ARE KEPT IN SEPARATE TABLES, SO THAT A ROM PAGE
+        // CAN STILL HIT ON READS WHILST IT'S WRITES ARE ROUTED THROUGH THE BUS
+        //
+        // ONLY PLAIN RAM IS EVER CACHED - MMIO, UNMAPPED PAGES AND PAGE CROSSINGS ALWAYS MISS
+        // AND ARE SERVICED BY THE BUS ITSELF
+        //
+        // THE CACHE IS INVALIDATED AUTOMATICALLY WHENEVER THE BUS GENERATION MOVES ON
+        // (ANY MAP, UNMAP OR REMAP) - THERE IS NO NEED TO FLUSH BY HAND
+        //
+        // A TLB IS NEVER SHARED - ON A SHARED BUS, EACH CPU THREAD KEEPS IT'S OWN IN FRONT OF THE BUS,
+        // AND PICKS UP ANOTHER THREAD'S REMAP THROUGH THE SAME GENERATION CHECK
+        template<typename BUS, U32 ENTRY_BITS = 8>
+        class MEMORY_TLB
+        {
+            public:
+                static constexpr U32 ENTRY_COUNT = 1U << ENTRY_BITS;
+                static constexpr U32 ENTRY_MASK = ENTRY_COUNT - 1;
+                static constexpr U32 INVALID_TAG = ~0U;
+
+                explicit MEMORY_TLB(BUS& MEMORY) : MEMORY(MEMORY)
+                {
+                    FLUSH();
+                }
+
+                template<typename T>
+                NOODLE_FORCE_INLINE T READ(U32 ADDRESS)
+                {
+                    static_assert(FUJIKO_BUS_WIDTH<T>, "TLB READS MUST BE U8, U16 OR U32");
+
+                    const U32 MASKED = ADDRESS & BUS::ADDRESS_MASK;
+                    const U32 PAGE = MASKED >> BUS::PAGE_BITS;
+                    const TLB_ENTRY& ENTRY = READ_ENTRIES[PAGE & ENTRY_MASK];
+
+                    if(NOODLE_LIKELY(ENTRY.TAG == PAGE && GENERATION == MEMORY.GENERATION
+                                     && (MASKED & BUS::PAGE_MASK) <= BUS::PAGE_SIZE - sizeof(T)))
+                    {
+                        #if NOODLE_TLB_STATS
+                            HITS++;
+                        #endif
+
+                        T VALUE;
+                        std::memcpy(&VALUE, reinterpret_cast<const U8*>(ENTRY.ADDEND + MASKED), sizeof(T));
+                        return BUS::ENDIAN_POLICY::CONVERT(VALUE);
+                    }
+
+                    MISS(PAGE);
+                    return MEMORY.template READ<T>(MASKED);
+                }
+
+                template<typename T>
+                NOODLE_FORCE_INLINE void WRITE(U32 ADDRESS, T VALUE)
+                {
+                    static_assert(FUJIKO_BUS_WIDTH<T>, "TLB WRITES MUST BE U8, U16 OR U32");
+
+                    const U32 MASKED = ADDRESS & BUS::ADDRESS_MASK;
+                    const U32 PAGE = MASKED >> BUS::PAGE_BITS;
+                    const TLB_ENTRY& ENTRY = WRITE_ENTRIES[PAGE & ENTRY_MASK];
+
+                    if(NOODLE_LIKELY(ENTRY.TAG == PAGE && GENERATION == MEMORY.GENERATION
+                                     && (MASKED & BUS::PAGE_MASK) <= BUS::PAGE_SIZE - sizeof(T)))
+                    {
+                        #if NOODLE_TLB_STATS
+                            HITS++;
+                        #endif
+
+                        VALUE = BUS::ENDIAN_POLICY::CONVERT(VALUE);
+                        std::memcpy(reinterpret_cast<U8*>(ENTRY.ADDEND + MASKED), &VALUE, sizeof(T));
+                        return;
+                    }
+
+                    MISS(PAGE);
+                    MEMORY.template WRITE<T>(MASKED, VALUE);
+                }
+
+                // DISCARD EVERY CACHED TRANSLATION AND RESYNCHRONISE WITH THE BUS
+                void FLUSH()
+                {
+                    READ_ENTRIES.fill(TLB_ENTRY{});
+                    WRITE_ENTRIES.fill(TLB_ENTRY{});
+                    GENERATION = MEMORY.GENERATION;
+                }
+
+                void RESET_COUNTERS()
+                {
+                    HITS = 0;
+                    MISSES = 0;
+                }
+
+                // HITS STAYS AT ZERO IN BUILDS WITHOUT NOODLE_TLB_STATS
+                U64 HITS = 0;
+                U64 MISSES = 0;
+
+            private:
+                struct TLB_ENTRY
+                {
+                    U32 TAG = INVALID_TAG;
+                    std::uintptr_t ADDEND = 0;
+                };
+
+                // REFILL BOTH TABLES FOR THE MISSED PAGE
+                // WHEN THE PAGE ISN'T PLAIN RAM THE SLOT IS LEFT INVALID, SO THE NEXT ACCESS MISSES AGAIN
+                NOODLE_NO_INLINE void MISS(U32 PAGE)
+                {
+                    MISSES++;
+
+                    if(GENERATION != MEMORY.GENERATION)
+                        FLUSH();
+
+                    const typename BUS::PAGE_ENTRY PAGE_ENTRY = MEMORY.PAGES[PAGE];
+                    const std::uintptr_t ADDEND = reinterpret_cast<std::uintptr_t>(BUS::PAGE_HOST(PAGE_ENTRY))
+                                                    - (static_cast<std::uintptr_t>(PAGE) << BUS::PAGE_BITS);
+
+                    TLB_ENTRY& READ_ENTRY = READ_ENTRIES[PAGE & ENTRY_MASK];
+                    TLB_ENTRY& WRITE_ENTRY = WRITE_ENTRIES[PAGE & ENTRY_MASK];
+
+                    READ_ENTRY = TLB_ENTRY{};
+                    WRITE_ENTRY = TLB_ENTRY{};
+
+                    if(BUS::READ_DIRECT(PAGE_ENTRY))
+                        READ_ENTRY = TLB_ENTRY{ PAGE, ADDEND };
+
+                    if(BUS::WRITE_DIRECT(PAGE_ENTRY))
+                        WRITE_ENTRY = TLB_ENTRY{ PAGE, ADDEND };
+                }
+
+                BUS& MEMORY;
+                U32 GENERATION = 0;
+
+                alignas(64) std::array<TLB_ENTRY, ENTRY_COUNT> READ_ENTRIES;
+                alignas(64) std::array<TLB_ENTRY, ENTRY_COUNT> WRITE_ENTRIES;
+        };
+    }
+}
+
+#endif
@@ -1,46 +1,1286 @@
-// COPYRIGHT (C) HARRY CLARK 2025
-// A LIGHTWEIGHT IMPLEMENTATION OF COMMON UTILITIES 
-
-// THIS FILE PERTAINS TOWARDS THE MODULARISATION OF A FULL FLEDGED MEMORY MAPPER UTILITY
-
-// NESTED INCLUDES
-
-#include <noodle/memory.hh>
-
-using namespace fujiko::memory;
-
-// SIMPLE CONSTRUCTOR FOR MEMORY ALLOCATION
-// ALWAYS PRESUPPOSE THAT NOTHING IS DONE SO WE RESET
-MEMORY::MEMORY()
-{
-    RESET(true);
-}
-
-// PROPER MEMORY RESET BASED ON RESET PIN OF THE SATURN
-// OTHER COMPONENTS SUCH AS SCU AND VDP ARE WITHSTANDING FOR THIS
-void MEMORY::RESET(bool MODE)
-{
-    if(MODE)
-    {
-        std::fill(MEMORY_ARRAY.begin(), MEMORY_ARRAY.end(), 0x00);
-        fmt::print("MEMORY RESET WITH ADDRESS: {:p}\n", static_cast<void*>(MEMORY_ARRAY.data()));
-    }
-}
-
-// THIS WILL ACT AS THE ALL ENCOMPASSING MEANS BY WHICH WE DEFINE
-// THE MEMORY MAPPER FOR THE WHOLE SYSTEM
-void MEMORY::MAP_MEMORY(MEMORY_BUS& BUS)
-{
-    BUS.MAP_ARRAY(0x0000000, 0x00080000, MEMORY_ARRAY, true);
-}
-
-int main(void)
-{
-    fmt::print("NOODLE - MEMORY BUS TEST\n");
-    MEMORY MEM;
-    MEMORY_BUS BUS;
-
-    MEM.MAP_MEMORY(BUS);
-    
-    return 0;
-}
+// COPYRIGHT (C) HARRY CLARK 2025
+// A LIGHTWEIGHT IMPLEMENTATION OF COMMON UTILITIES 
+
+// THIS FILE PERTAINS TOWARDS THE MODULARISATION OF A FULL FLEDGED MEMORY MAPPER UTILITY
+
+// NESTED INCLUDES
+
+#include <noodle/binlog.hh>
+#include <noodle/bits.hh>
+#include <noodle/memory.hh>
+#include <noodle/mmu.hh>
+#include <noodle/tlb.hh>
+
+// SYSTEM INCLUDES
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <set>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include <unistd.h>
+
+using namespace fujiko::memory;
+
+// SIMPLE CONSTRUCTOR FOR MEMORY ALLOCATION
+// ALWAYS PRESUPPOSE THAT NOTHING IS DONE SO WE RESET
+MEMORY::MEMORY()
+{
+    RESET(true);
+}
+
+// PROPER MEMORY RESET BASED ON RESET PIN OF THE SATURN
+// OTHER COMPONENTS SUCH AS SCU AND VDP ARE WITHSTANDING FOR THIS
+void MEMORY::RESET(bool MODE)
+{
+    if(MODE)
+    {
+        std::fill(MEMORY_ARRAY.begin(), MEMORY_ARRAY.end(), 0x00);
+        fmt::print("MEMORY RESET WITH ADDRESS: {:p}\n", static_cast<void*>(MEMORY_ARRAY.data()));
+    }
+}
+
+// THIS WILL ACT AS THE ALL ENCOMPASSING MEANS BY WHICH WE DEFINE
+// THE MEMORY MAPPER FOR THE WHOLE SYSTEM
+void MEMORY::MAP_MEMORY(MEMORY_BUS& BUS)
+{
+    BUS.MAP_ARRAY(0x0000000, 0x00080000, MEMORY_ARRAY, true).REPORT();
+}
+
+// SIMPLE ASSERTION HELPER - TALLIES UP ANY FAILURES SO THAT THE TEST EXECUTABLE
+// CAN REPORT A NON-ZERO EXIT CODE BACK TO CTEST
+static int FAILURES = 0;
+
+#define CHECK(EXPR)                                                         \
+    do                                                                      \
+    {                                                                       \
+        if(!(EXPR))                                                         \
+        {                                                                   \
+            fmt::print("CHECK FAILED: {} ({}:{})\n", #EXPR, __FILE__, __LINE__); \
+            FAILURES++;                                                     \
+        }                                                                   \
+    } while(0)
+
+// VALIDATE THE TYPED FAST PATH AGAINST THE MAPPED ARRAY
+// THE ARRAY IS MIRRORED ACROSS EVERY PAGE IN THE MAPPED RANGE
+static void TEST_READ_WRITE(MEMORY_BUS& BUS)
+{
+    BUS.WRITE<U8>(0x00000010, 0xAB);
+    CHECK(BUS.READ<U8>(0x00000010) == 0xAB);
+    CHECK(MEMORY_ARRAY[0x10] == 0xAB);
+
+    BUS.WRITE<U16>(0x00000020, 0xBEEF);
+    CHECK(BUS.READ<U16>(0x00000020) == 0xBEEF);
+
+    BUS.WRITE<U32>(0x00000040, 0xDEADBEEF);
+    CHECK(BUS.READ<U32>(0x00000040) == 0xDEADBEEF);
+    CHECK(BUS.READ<U32>(0x00010040) == 0xDEADBEEF);
+
+    // ACCESSES STRADDLING A PAGE BOUNDARY GO THROUGH THE SLOW PATH
+    BUS.WRITE<U32>(0x0000FFFE, 0x11223344);
+    CHECK(BUS.READ<U32>(0x0000FFFE) == 0x11223344);
+
+    // UNMAPPED PAGES READ AS OPEN BUS AND DROP WRITES
+    BUS.WRITE<U32>(0x00100000, 0xFFFFFFFF);
+    CHECK(BUS.READ<U32>(0x00100000) == 0);
+}
+
+// STAND-IN DEVICE FOR VALIDATING HANDLER DISPATCH
+struct TEST_DEVICE
+{
+    U16 REGISTER = 0;
+
+    U16 READ_16(U32 ADDRESS) { return REGISTER; }
+    void WRITE_16(U32 ADDRESS, U16 VALUE) { REGISTER = VALUE; }
+};
+
+static U8 TEST_READ_8(U32 ADDRESS, void* CTX)
+{
+    return static_cast<U8>(ADDRESS);
+}
+
+// VALIDATE THAT BOTH BOUND AND RAW HANDLERS ARE REACHED THROUGH THE PAGE TABLE
+static void TEST_HANDLERS(MEMORY_BUS& BUS)
+{
+    TEST_DEVICE DEV;
+
+    CHECK(BUS.MAP_HANDLER(0x00200000, 0x0020FFFF, &DEV,
+                          FUJIKO_DEVICE_HANDLER<&TEST_DEVICE::READ_16, &TEST_DEVICE::WRITE_16>(),
+                          FUJIKO_HANDLER<U8>{ TEST_READ_8, nullptr }));
+
+    BUS.WRITE<U16>(0x00200004, 0x1234);
+    CHECK(DEV.REGISTER == 0x1234);
+    CHECK(BUS.READ<U16>(0x00200008) == 0x1234);
+    CHECK(BUS.READ<U8>(0x00200042) == 0x42);
+
+    // WIDTHS WITHOUT A HANDLER READ AS OPEN BUS
+    CHECK(BUS.READ<U32>(0x00200000) == 0);
+    BUS.WRITE<U8>(0x00200000, 0xFF);
+
+    // REMAPPING OVER THE SAME RANGE FREES EACH RECORD AS SOON AS NO PAGE REFERS TO IT
+    const std::size_t HELD = BUS.OWNED_COUNT();
+
+    for(U32 REMAP = 0; REMAP < 100; REMAP++)
+        CHECK(BUS.MAP_HANDLER(0x00200000, 0x0020FFFF, &DEV, FUJIKO_HANDLER<U8>{ TEST_READ_8, nullptr }));
+
+    CHECK(BUS.OWNED_COUNT() == HELD);
+    CHECK(BUS.READ<U8>(0x00200042) == 0x42);
+
+    // THE DEVICE LIVES ON THIS FRAME, SO IT MUST NOT OUTLIVE THE TEST ON THE SHARED BUS
+    CHECK(BUS.UNMAP(0x00200000, 0x0020FFFF));
+    CHECK(BUS.OWNED_COUNT() == HELD - 1);
+}
+
+// VALIDATE ALTERNATE GEOMETRIES - A 24-BIT FLAT TABLE AND A 32-BIT TWO-LEVEL TABLE WITH 4KB PAGES
+static void TEST_GEOMETRY()
+{
+    BASIC_MEMORY_BUS<24, 16> BUS_24;
+    CHECK(BUS_24.MAP_ARRAY(0x00000000, 0x0000FFFF, MEMORY_ARRAY, true));
+    BUS_24.WRITE<U16>(0x01000080, 0xCAFE);
+    CHECK(BUS_24.READ<U16>(0x00000080) == 0xCAFE);
+
+    auto BUS_32 = std::make_unique<BASIC_MEMORY_BUS<32, 12>>();
+    CHECK(BUS_32->MAP_ARRAY(0xFFFF0000, 0xFFFFFFFF, MEMORY_ARRAY, true));
+    BUS_32->WRITE<U32>(0xFFFF1000, 0x01020304);
+    CHECK(BUS_32->READ<U32>(0xFFFF1000) == 0x01020304);
+    // THE BUS IS NATIVE ORDER, SO THE FIRST BYTE IN MEMORY IS WHICHEVER END THE HOST STORES FIRST
+    CHECK(MEMORY_ARRAY[0x1000] == (fujiko::bits::HOST_BIG ? 0x01 : 0x04));
+    CHECK(BUS_32->READ<U32>(0x7FFF1000) == 0);
+}
+
+// VALIDATE THE SOFTWARE TLB - HITS AFTER THE FIRST ACCESS, AND INVALIDATION ON REMAP
+static void TEST_TLB(MEMORY_BUS& BUS)
+{
+    MEMORY_TLB<MEMORY_BUS> TLB(BUS);
+
+    TLB.WRITE<U32>(0x00000100, 0xA5A5A5A5);
+    CHECK(TLB.READ<U32>(0x00000100) == 0xA5A5A5A5);
+    CHECK(TLB.READ<U32>(0x00000104) == BUS.READ<U32>(0x00000104));
+    CHECK(!NOODLE_TLB_STATS || TLB.HITS > 0);
+    CHECK(TLB.MISSES == 1);
+
+    // REMAPPING THE PAGE MUST NOT LEAVE A STALE TRANSLATION BEHIND
+    CHECK(BUS.UNMAP(0x00000000, 0x0000FFFF));
+    CHECK(TLB.READ<U32>(0x00000100) == 0);
+
+    CHECK(BUS.MAP_ARRAY(0x00000000, 0x0000FFFF, MEMORY_ARRAY, false));
+    CHECK(TLB.READ<U32>(0x00000100) == 0xA5A5A5A5);
+    TLB.WRITE<U32>(0x00000100, 0);
+    CHECK(TLB.READ<U32>(0x00000100) == 0xA5A5A5A5);
+
+    CHECK(BUS.MAP_ARRAY(0x00000000, 0x0000FFFF, MEMORY_ARRAY, true));
+}
+
+// VALIDATE THE 68851 TABLE WALK AND ATC
+// TWO LEVELS OF 10 BITS WITH 4KB PAGES, USING SHORT DESCRIPTORS HELD IN THE MAPPED ARRAY
+static void TEST_MMU(MEMORY_BUS& BUS)
+{
+    static constexpr U32 TABLE_A = 0x2000;
+    static constexpr U32 TABLE_B = 0x4000;
+    static constexpr U32 TABLE_C = 0x5000;
+
+    BUS.FILL(TABLE_A, 0x00, 0x6000 - TABLE_A);
+
+    BUS.WRITE<U32>(TABLE_A + (1 * 4), TABLE_B | MMU_68851<MEMORY_BUS>::DT_SHORT);
+    BUS.WRITE<U32>(TABLE_B + (0 * 4), 0x8000 | MMU_68851<MEMORY_BUS>::DT_PAGE);
+    BUS.WRITE<U32>(TABLE_B + (1 * 4), 0x9000 | MMU_68851<MEMORY_BUS>::DESC_WP | MMU_68851<MEMORY_BUS>::DT_PAGE);
+
+    // A SUPERVISOR ONLY PAGE, WHICH NEEDS A LONG DESCRIPTOR TO CARRY THE S BIT
+    BUS.WRITE<U32>(TABLE_A + (3 * 4), TABLE_C | MMU_68851<MEMORY_BUS>::DT_LONG);
+    BUS.WRITE<U32>(TABLE_C, MMU_68851<MEMORY_BUS>::DESC_S | MMU_68851<MEMORY_BUS>::DT_PAGE);
+    BUS.WRITE<U32>(TABLE_C + 4, 0xA000);
+
+    MMU_68851<MEMORY_BUS> MMU(BUS);
+    MMU.SET_CRP(MMU_68851<MEMORY_BUS>::DT_SHORT, TABLE_A);
+    CHECK(MMU.SET_TC(0x80C0AA00) == MMU_FAULT::NONE);
+
+
+    MMU_TRANSLATION RESULT = MMU.TRANSLATE(0x00400123, fc::USER_DATA, false);
+    CHECK(RESULT.FAULT == MMU_FAULT::NONE && RESULT.PHYSICAL == 0x8123);
+    CHECK(MMU.WALKS == 1);
+
+    // SECOND ACCESS TO THE SAME PAGE HITS THE ATC
+    RESULT = MMU.TRANSLATE(0x00400456, fc::USER_DATA, false);
+    CHECK(RESULT.PHYSICAL == 0x8456 && MMU.WALKS == 1);
+
+    // A REJECTED CONFIGURATION LEAVES THE PREVIOUS ONE, AND IT'S ATC ENTRIES, IN FORCE
+    CHECK(MMU.SET_TC(0x80C0AAA0) == MMU_FAULT::CONFIG);
+    CHECK(MMU.GET_TC() == 0x80C0AA00);
+    CHECK(MMU.TRANSLATE(0x00400789, fc::USER_DATA, false).PHYSICAL == 0x8789 && MMU.WALKS == 1);
+
+    // THE FIRST WRITE WALKS AGAIN TO SET THE MODIFIED BIT
+    CHECK(MMU.WRITE<U32>(0x00400010, fc::USER_DATA, 0x600DF00D) == MMU_FAULT::NONE);
+    CHECK(BUS.READ<U32>(0x8010) == 0x600DF00D);
+    CHECK(BUS.READ<U32>(TABLE_B) & MMU_68851<MEMORY_BUS>::DESC_M);
+
+    U32 VALUE = 0;
+    CHECK(MMU.READ<U32>(0x00400010, fc::USER_DATA, VALUE) == MMU_FAULT::NONE && VALUE == 0x600DF00D);
+
+    CHECK(MMU.TRANSLATE(0x00401000, fc::USER_DATA, true).FAULT == MMU_FAULT::WRITE_PROTECT);
+    CHECK(MMU.TRANSLATE(0x00401000, fc::USER_DATA, false).FAULT == MMU_FAULT::NONE);
+    CHECK(MMU.TRANSLATE(0x00800000, fc::USER_DATA, false).FAULT == MMU_FAULT::INVALID);
+
+    // A USER WRITE TO A SUPERVISOR PAGE FAULTS WITHOUT MARKING THE PAGE USED OR MODIFIED
+    CHECK(MMU.WRITE<U32>(0x00C00010, fc::USER_DATA, 0xDEADBEEF) == MMU_FAULT::SUPERVISOR);
+    CHECK((BUS.READ<U32>(TABLE_C) & (MMU_68851<MEMORY_BUS>::DESC_U | MMU_68851<MEMORY_BUS>::DESC_M)) == 0);
+    CHECK(BUS.READ<U32>(0xA010) != 0xDEADBEEF);
+
+    CHECK(MMU.WRITE<U32>(0x00C00010, fc::SUPERVISOR_DATA, 0xDEADBEEF) == MMU_FAULT::NONE);
+    CHECK(BUS.READ<U32>(TABLE_C) & MMU_68851<MEMORY_BUS>::DESC_M);
+    CHECK(BUS.READ<U32>(0xA010) == 0xDEADBEEF);
+
+    // THE SAME FAULTS AS RESULTS, WITH THE FAULT AS THEIR CODE
+    const auto TRIED = MMU.TRY_READ<U32>(0x00400010, fc::USER_DATA);
+    CHECK(TRIED && TRIED.VALUE() == 0x600DF00D);
+
+    const auto DENIED = MMU.TRY_WRITE<U32>(0x00401000, fc::USER_DATA, 0);
+    CHECK(!DENIED && DENIED.ERROR().CODE() == static_cast<U64>(MMU_FAULT::WRITE_PROTECT));
+    CHECK(DENIED.ERROR().MESSAGE() == "MMU: WRITE PROTECT FAULT AT 0x00401000");
+    CHECK(MMU.TRY_READ<U8>(0x00800000, fc::USER_DATA).ERROR().CATEGORY() == ERROR_CATEGORY::OOB);
+
+    // FLUSHING BY FUNCTION CODE ONLY DISCARDS THE MATCHING ENTRIES
+    const U64 WALKS = MMU.WALKS;
+    MMU.TRANSLATE(0x00400000, fc::SUPERVISOR_DATA, false);
+    MMU.FLUSH_FC(fc::SUPERVISOR_DATA, 0x7);
+    MMU.TRANSLATE(0x00400000, fc::USER_DATA, false);
+    CHECK(MMU.WALKS == WALKS + 1);
+    MMU.TRANSLATE(0x00400000, fc::SUPERVISOR_DATA, false);
+    CHECK(MMU.WALKS == WALKS + 2);
+}
+
+// BYTE-WIDE DEVICE WHICH SIMPLY COUNTS THE WRITES IT RECEIVES
+static void TEST_COUNT_WRITE(U32 ADDRESS, U8 VALUE, void* CTX)
+{
+    (*static_cast<U32*>(CTX))++;
+}
+
+// VALIDATE THE BULK TRANSFER PATH - RUNS ACROSS PAGES, MIRRORS, OVERLAPPING COPIES AND MMIO FALLBACK
+static void TEST_BLOCK(MEMORY_BUS& BUS)
+{
+    U8 BUFFER[0x200] = {};
+
+    // A FILL OVER MIRRORED PAGES LANDS IN THE SAME BACKING ARRAY
+    BUS.FILL(0x0003FF00, 0x5A, 0x200);
+    BUS.READ_BLOCK(0x0000FF00, BUFFER, 0x100);
+    CHECK(BUFFER[0] == 0x5A && BUFFER[0xFF] == 0x5A);
+    CHECK(MEMORY_ARRAY[0x0000] == 0x5A && MEMORY_ARRAY[0x00FF] == 0x5A && MEMORY_ARRAY[0x0100] != 0x5A);
+
+    for(U32 INDEX = 0; INDEX < sizeof(BUFFER); INDEX++)
+        BUFFER[INDEX] = static_cast<U8>(INDEX);
+
+    // A WRITE STRADDLING A PAGE BOUNDARY
+    BUS.WRITE_BLOCK(0x0001FFF0, BUFFER, 0x20);
+    CHECK(BUS.READ<U8>(0x0001FFF0) == 0x00 && BUS.READ<U8>(0x00020000) == 0x10);
+
+    // OVERLAPPING COPIES IN BOTH DIRECTIONS
+    BUS.WRITE_BLOCK(0x00000500, BUFFER, 0x10);
+    BUS.COPY(0x00000504, 0x00000500, 0x10);
+    CHECK(BUS.READ<U8>(0x00000504) == 0x00 && BUS.READ<U8>(0x00000513) == 0x0F);
+
+    BUS.COPY(0x00000500, 0x00000504, 0x10);
+    CHECK(BUS.READ<U8>(0x00000500) == 0x00 && BUS.READ<U8>(0x0000050F) == 0x0F);
+
+    // COPIES INTO MMIO GO THROUGH THE HANDLER, ONE CALL PER BYTE
+    U32 WRITES = 0;
+    CHECK(BUS.MAP_HANDLER(0x00300000, 0x0030FFFF, &WRITES, FUJIKO_HANDLER<U8>{ nullptr, TEST_COUNT_WRITE }));
+    BUS.COPY(0x00300000, 0x00000000, 0x300);
+    CHECK(WRITES == 0x300);
+    CHECK(BUS.UNMAP(0x00300000, 0x0030FFFF));
+
+    // A DEVICE WITH ONLY A 16-BIT HANDLER SEES ALIGNED HALFWORDS, WITH BYTES LEFT FOR THE UNALIGNED EDGES
+    TEST_DEVICE DEV;
+    CHECK(BUS.MAP_HANDLER(0x00300000, 0x0030FFFF, &DEV, FUJIKO_DEVICE_HANDLER<&TEST_DEVICE::READ_16, &TEST_DEVICE::WRITE_16>()));
+
+    const U8 PAIR[2] = { 0x12, 0x34 };
+    BUS.WRITE_BLOCK(0x00300010, PAIR, 2);
+    CHECK(DEV.REGISTER == BUS.READ<U16>(0x00300010) && DEV.REGISTER != 0);
+
+    BUS.READ_BLOCK(0x00300000, BUFFER, 0x10);
+    CHECK(BUFFER[0] == PAIR[0] && BUFFER[1] == PAIR[1] && BUFFER[0xE] == PAIR[0] && BUFFER[0xF] == PAIR[1]);
+
+    BUS.FILL(0x00300001, 0x77, 4);
+    CHECK(DEV.REGISTER == 0x7777);
+    CHECK(BUS.UNMAP(0x00300000, 0x0030FFFF));
+
+    // UNMAPPED SPACE READS AS OPEN BUS
+    BUS.READ_BLOCK(0x00400000, BUFFER, 0x10);
+    CHECK(BUFFER[0] == 0 && BUFFER[0xF] == 0);
+}
+
+// HOST BUFFERS AND FILES ARE MAPPED IN PLACE RATHER THAN COPIED
+static void TEST_MAPPED(MEMORY_BUS& BUS)
+{
+    alignas(64) static U8 BUFFER[MEMORY_BUS::PAGE_SIZE];
+    BUFFER[0x10] = 0x5A;
+
+    CHECK(BUS.MAP_BUFFER(0x400000, 0x41FFFF, BUFFER, sizeof(BUFFER)));
+    CHECK(BUS.READ<U8>(0x400010) == 0x5A);
+    CHECK(BUS.READ<U8>(0x410010) == 0x5A);
+    BUS.WRITE<U8>(0x400011, 0xA5);
+    CHECK(BUFFER[0x11] == 0xA5);
+    CHECK(!BUS.MAP_BUFFER(0x400000, 0x40FFFF, BUFFER + 1, sizeof(BUFFER) - 1));
+
+    char PATH[] = "/tmp/noodle_imageXXXXXX";
+    const int FD = ::mkstemp(PATH);
+    CHECK(FD >= 0);
+
+    const U8 IMAGE[] = { 0xDE, 0xAD, 0xBE, 0xEF, 0x01 };
+    CHECK(::write(FD, IMAGE, sizeof(IMAGE)) == static_cast<ssize_t>(sizeof(IMAGE)));
+    ::close(FD);
+
+    CHECK(BUS.MAP_IMAGE(0x500000, 0x50FFFF, PATH, false, FUJIKO_MAP_MODE::PRIVATE, FUJIKO_ADVICE::WILLNEED));
+    CHECK(BUS.READ<U8>(0x500000) == 0xDE);
+    CHECK(BUS.READ<U8>(0x500004) == 0x01);
+    CHECK(BUS.READ<U8>(0x500005) == 0x00);
+    CHECK(BUS.READ<U8>(0x50FFFF) == 0x00);
+    BUS.WRITE<U8>(0x500000, 0x00);
+    CHECK(BUS.READ<U8>(0x500000) == 0xDE);
+
+    CHECK(!BUS.MAP_IMAGE(0x500000, 0x50FFFF, "/nonexistent/noodle.bin", false));
+
+    // REMAPPING AN IMAGE OVER ITSELF UNMAPS THE ONE IT REPLACES, AND UNMAPPING THE RANGE UNMAPS THE LAST
+    const std::size_t HELD = BUS.OWNED_COUNT();
+
+    for(U32 REMAP = 0; REMAP < 50; REMAP++)
+        CHECK(BUS.MAP_IMAGE(0x500000, 0x50FFFF, PATH, false));
+
+    CHECK(BUS.OWNED_COUNT() == HELD && BUS.READ<U8>(0x500001) == 0xAD);
+
+    CHECK(!BUS.UNMAP(0x500000, 0x0FFFFFFF));
+    CHECK(BUS.UNMAP(0x400000, 0x50FFFF));
+    CHECK(BUS.OWNED_COUNT() == HELD - 1);
+    ::unlink(PATH);
+}
+
+// SNAPSHOTS ONLY HOLD WHAT WAS WRITTEN SINCE, AND ROLL BACK THROUGH ANY NUMBER OF EPOCHS
+static void TEST_SNAPSHOT(void)
+{
+    alignas(64) static std::array<U8, 0x20000> RAM;
+    MEMORY_BUS BUS;
+    CHECK(BUS.MAP_ARRAY(0x000000, 0x01FFFF, RAM, true));
+
+    CHECK(!BUS.ENABLE_TRACKING(MEMORY_BUS::PAGE_BITS + 1));
+    CHECK(BUS.ENABLE_TRACKING(6));
+
+    BUS.WRITE<U32>(0x100, 0x11111111);
+    const U32 FIRST = BUS.SNAPSHOT();
+    CHECK(!BUS.IS_DIRTY(0x100));
+
+    BUS.WRITE<U32>(0x100, 0x22222222);
+    BUS.FILL(0x10000, 0xAA, 0x80);
+    CHECK(BUS.IS_DIRTY(0x100));
+    CHECK(!BUS.IS_DIRTY(0x140));
+    CHECK(BUS.DIRTY_PAGE_COUNT() == 2);
+    CHECK(BUS.SNAPSHOT_BYTES() == 0x40 + 0x80);
+
+    const U32 SECOND = BUS.SNAPSHOT();
+    BUS.WRITE<U32>(0x100, 0x33333333);
+    BUS.WRITE<U16>(0x13F, 0xBEEF);
+    BUS.FILL(0x10000, 0x55, 0x10);
+
+    CHECK(BUS.RESTORE(SECOND));
+    CHECK(BUS.READ<U32>(0x100) == 0x22222222);
+    CHECK(BUS.READ<U8>(0x140) == 0x00);
+    CHECK(BUS.READ<U8>(0x10000) == 0xAA);
+
+    CHECK(BUS.RESTORE(FIRST));
+    CHECK(BUS.READ<U32>(0x100) == 0x11111111);
+    CHECK(BUS.READ<U8>(0x10000) == 0x00);
+    CHECK(!BUS.RESTORE(SECOND));
+
+    // AT PAGE GRANULARITY ONLY THE FIRST WRITE TO A PAGE IS TRAPPED
+    CHECK(BUS.ENABLE_TRACKING());
+    const U32 PAGE = BUS.SNAPSHOT();
+    BUS.WRITE<U32>(0x200, 0x44444444);
+    CHECK(!(BUS.PAGES[0] & MEMORY_BUS::PAGE_TRACKED));
+    CHECK(BUS.SNAPSHOT_BYTES() == MEMORY_BUS::PAGE_SIZE);
+    BUS.TRIM(PAGE);
+    CHECK(BUS.RESTORE(PAGE));
+    CHECK(BUS.READ<U32>(0x200) == 0);
+    CHECK(BUS.PAGES[0] & MEMORY_BUS::PAGE_TRACKED);
+
+    // AN IMAGE UNMAPPED AFTER A SNAPSHOT TAKES IT'S PRE-IMAGES WITH IT, WHILST THE REST STILL ROLL BACK
+    char PATH[] = "/tmp/noodle_undoXXXXXX";
+    const int FD = ::mkstemp(PATH);
+    CHECK(FD >= 0);
+
+    const U8 IMAGE[] = { 0xDE, 0xAD, 0xBE, 0xEF };
+    CHECK(::write(FD, IMAGE, sizeof(IMAGE)) == static_cast<ssize_t>(sizeof(IMAGE)));
+    ::close(FD);
+
+    CHECK(BUS.MAP_IMAGE(0x100000, 0x10FFFF, PATH, true));
+    const U32 IMAGED = BUS.SNAPSHOT();
+    BUS.WRITE<U32>(0x100000, 0x12345678);
+    BUS.WRITE<U32>(0x300, 0x66666666);
+    CHECK(BUS.UNMAP(0x100000, 0x10FFFF));
+    CHECK(BUS.RESTORE(IMAGED));
+    CHECK(BUS.READ<U32>(0x300) == 0);
+    ::unlink(PATH);
+
+    BUS.DISABLE_TRACKING();
+    CHECK(!BUS.TRACKING());
+    CHECK(!(BUS.PAGES[1] & MEMORY_BUS::PAGE_TRACKED));
+}
+
+// WATCHPOINTS ONLY TRAP THE PAGES THEY COVER, AND REPORT EACH ACCESS ONCE
+static void TEST_WATCH_EVENT(const FUJIKO_WATCH_EVENT& EVENT, void* CTX)
+{
+    std::vector<FUJIKO_WATCH_EVENT>* EVENTS = static_cast<std::vector<FUJIKO_WATCH_EVENT>*>(CTX);
+    EVENTS->push_back(EVENT);
+}
+
+static void TEST_WATCH(void)
+{
+    alignas(64) static std::array<U8, 0x20000> RAM;
+    std::vector<FUJIKO_WATCH_EVENT> EVENTS;
+
+    MEMORY_BUS BUS;
+    CHECK(BUS.MAP_ARRAY(0x000000, 0x01FFFF, RAM, true));
+
+    const U32 WRITES = BUS.ADD_WATCH(0x1000, 0x1003, watch::WRITE, TEST_WATCH_EVENT, &EVENTS);
+    const U32 FETCHES = BUS.ADD_WATCH(0x1FFFE, 0x1FFFF, watch::EXECUTE, TEST_WATCH_EVENT, &EVENTS);
+    CHECK(BUS.ADD_WATCH(0x10, 0x0F, watch::READ, TEST_WATCH_EVENT) == ~0U);
+
+    for(U32 INDEX = 0; INDEX < 1000; INDEX++)
+        BUS.ADD_WATCH(0x10000 + INDEX * 4, 0x10001 + INDEX * 4, watch::READ, TEST_WATCH_EVENT, &EVENTS);
+
+    CHECK(!(BUS.PAGES[0] & MEMORY_BUS::PAGE_TRAP_READ));
+    CHECK(BUS.PAGES[0] & MEMORY_BUS::PAGE_TRAP_WRITE);
+    CHECK(BUS.PAGES[1] & MEMORY_BUS::PAGE_TRAP_READ);
+
+    BUS.WRITE<U32>(0x0FFE, 0x11223344);
+    BUS.WRITE<U8>(0x1004, 0xFF);
+    BUS.READ<U32>(0x1000);
+    CHECK(EVENTS.size() == 1);
+    CHECK(EVENTS[0].ADDRESS == 0x0FFE && EVENTS[0].SIZE == 4 && EVENTS[0].VALUE == 0x11223344);
+    CHECK(EVENTS[0].ACCESS == watch::WRITE);
+
+    EVENTS.clear();
+    BUS.READ<U16>(0x10F9C);
+    BUS.READ<U16>(0x10F9E);
+    BUS.READ<U16>(0x1FFFE);
+    CHECK(EVENTS.size() == 1 && EVENTS[0].ADDRESS == 0x10F9C);
+
+    RAM[0x1FFFE] = 0x4E;
+    BUS.FETCH<U8>(0x1FFFE);
+    CHECK(EVENTS.size() == 2 && EVENTS[1].ACCESS == watch::EXECUTE && EVENTS[1].VALUE == RAM[0x1FFFE]);
+
+    // REMAPPING BENEATH A WATCHPOINT KEEPS IT'S TRAPS
+    CHECK(BUS.MAP_ARRAY(0x000000, 0x00FFFF, RAM, true));
+    CHECK(BUS.PAGES[0] & MEMORY_BUS::PAGE_TRAP_WRITE);
+
+    CHECK(BUS.REMOVE_WATCH(WRITES));
+    CHECK(!BUS.REMOVE_WATCH(WRITES));
+    CHECK(!(BUS.PAGES[0] & MEMORY_BUS::PAGE_TRAP_WRITE));
+    CHECK(BUS.REMOVE_WATCH(FETCHES));
+    CHECK(BUS.PAGES[1] & MEMORY_BUS::PAGE_TRAP_READ);
+
+    BUS.CLEAR_WATCHES();
+    CHECK(BUS.WATCH_COUNT() == 0);
+    CHECK(!(BUS.PAGES[0] & MEMORY_BUS::PAGE_TRAPS));
+    CHECK(!(BUS.PAGES[1] & MEMORY_BUS::PAGE_TRAPS));
+
+    // ONE WIDE RANGE IN FRONT OF MANY NARROW ONES STILL ONLY REPORTS THOSE THE ACCESS OVERLAPS
+    BUS.ADD_WATCH(0x00000, 0x1FFFF, watch::READ, TEST_WATCH_EVENT, &EVENTS);
+
+    for(U32 INDEX = 0; INDEX < 1000; INDEX++)
+        BUS.ADD_WATCH(0x10000 + INDEX * 4, 0x10001 + INDEX * 4, watch::READ, TEST_WATCH_EVENT, &EVENTS);
+
+    EVENTS.clear();
+    BUS.READ<U16>(0x10F9C);
+    CHECK(EVENTS.size() == 2);
+    BUS.READ<U16>(0x10F9E);
+    CHECK(EVENTS.size() == 3);
+
+    BUS.CLEAR_WATCHES();
+}
+
+// READERS ON OTHER THREADS ONLY EVER SEE A WHOLE MAPPING, NEVER A TORN ONE
+// EACH REMAP COVERS SEVERAL PAGES WITH A FRESH BUFFER STAMPED WITH IT'S OWN VERSION, SO A READER WALKING
+// THE PAGES IN ORDER MUST NEVER SEE A PAGE OLDER THAN ONE IT HAS ALREADY READ - A TORN PUBLISH WOULD
+// SHOW AS A NEWER FIRST PAGE FOLLOWED BY AN OLDER ONE
+static void TEST_SHARED(void)
+{
+    using SMALL_SHARED_BUS = BASIC_MEMORY_BUS<20, 12, FUJIKO_ENDIAN_NATIVE, FUJIKO_SYNC_SHARED>;
+
+    static constexpr U32 VERSIONS = 512;
+    static constexpr U32 SPAN = 4 * SMALL_SHARED_BUS::PAGE_SIZE;
+
+    struct alignas(64) STAMPED
+    {
+        U32 WORDS[SPAN / 4];
+    };
+
+    std::vector<STAMPED> POOL(VERSIONS);
+
+    for(U32 VERSION = 0; VERSION < VERSIONS; VERSION++)
+        std::fill(std::begin(POOL[VERSION].WORDS), std::end(POOL[VERSION].WORDS), VERSION);
+
+    SMALL_SHARED_BUS BUS;
+    CHECK(BUS.MAP_BUFFER(0x00000, SPAN - 1, reinterpret_cast<U8*>(POOL[0].WORDS), SPAN));
+
+    std::atomic<bool> DONE{false};
+    std::atomic<U32> TORN{0};
+    std::atomic<U32> INVALID{0};
+
+    auto READER = [&]()
+    {
+        const U32 SLOT = BUS.PAGES.REGISTER_READER();
+        MEMORY_TLB<SMALL_SHARED_BUS> TLB(BUS);
+        U32 LAST = 0;
+
+        while(!DONE.load())
+        {
+            for(U32 PAGE = 0; PAGE < SPAN / SMALL_SHARED_BUS::PAGE_SIZE; PAGE++)
+            {
+                const U32 ADDRESS = PAGE * SMALL_SHARED_BUS::PAGE_SIZE + ((PAGE * 0x124) & 0xFFC);
+                const U32 VALUE = BUS.READ<U32>(ADDRESS);
+
+                if(VALUE < LAST) TORN++;
+                LAST = VALUE;
+
+                // THE TLB ONLY CATCHES UP WITH A REMAP ONCE THE GENERATION MOVES ON,
+                // BUT WHAT IT RETURNS MUST STILL BE A WORD OF SOME PUBLISHED VERSION
+                if(TLB.READ<U32>(ADDRESS) >= VERSIONS) INVALID++;
+            }
+
+            BUS.PAGES.QUIESCENT(SLOT);
+        }
+
+        BUS.PAGES.UNREGISTER_READER(SLOT);
+    };
+
+    std::thread READERS[] = { std::thread(READER), std::thread(READER) };
+
+    for(U32 VERSION = 1; VERSION < VERSIONS; VERSION++)
+        CHECK(BUS.MAP_BUFFER(0x00000, SPAN - 1, reinterpret_cast<U8*>(POOL[VERSION].WORDS), SPAN));
+
+    DONE.store(true);
+    for(std::thread& THREAD : READERS) THREAD.join();
+
+    CHECK(TORN.load() == 0);
+    CHECK(INVALID.load() == 0);
+    CHECK(BUS.READ<U32>(SPAN - 4) == VERSIONS - 1);
+    BUS.PAGES.RECLAIM();
+    CHECK(BUS.PAGES.RETIRED() == 0);
+
+    // A RECORD UNMAPPED FROM A SHARED BUS WAITS FOR THE READERS, RATHER THAN BEING FREED UNDER THEM
+    const U32 SLOT = BUS.PAGES.REGISTER_READER();
+    CHECK(BUS.MAP_HANDLER(0x00000, 0x00FFF, nullptr, FUJIKO_HANDLER<U8>{ TEST_READ_8, nullptr }));
+    CHECK(BUS.OWNED_COUNT() == 1);
+    CHECK(BUS.UNMAP(0x00000, 0x00FFF));
+    CHECK(BUS.OWNED_COUNT() == 0 && BUS.PAGES.RETIRED() > 0);
+    BUS.PAGES.QUIESCENT(SLOT);
+    BUS.PAGES.RECLAIM();
+    CHECK(BUS.PAGES.RETIRED() == 0);
+    BUS.PAGES.UNREGISTER_READER(SLOT);
+
+    alignas(64) static std::array<U8, 0x10000> FIRST;
+    alignas(64) static std::array<U8, 0x10000> SECOND;
+    FIRST.fill(0xAA);
+    SECOND.fill(0xBB);
+
+    // WIDE GEOMETRIES ONLY COPY THE LEAVES AN EDIT TOUCHES
+    auto WIDE = std::make_unique<BASIC_MEMORY_BUS<32, 12, FUJIKO_ENDIAN_NATIVE, FUJIKO_SYNC_SHARED>>();
+    CHECK(WIDE->MAP_BUFFER(0xFFFFF000, 0xFFFFFFFF, SECOND.data(), 0x1000));
+    CHECK(WIDE->MAP_BUFFER(0x00000000, 0x00000FFF, FIRST.data(), 0x1000));
+    CHECK(WIDE->READ<U8>(0xFFFFFFFF) == 0xBB);
+    CHECK(WIDE->READ<U8>(0x00000000) == 0xAA);
+    CHECK(WIDE->READ<U8>(0x80000000) == 0x00);
+}
+
+// A DEVICE LAID OVER PART OF A RAM PAGE LEAVES THE REST OF THE PAGE AS RAM
+static void TEST_SPLIT(void)
+{
+    alignas(64) static std::array<U8, 0x10000> RAM;
+    alignas(64) static U8 SRAM[0x20];
+    static U32 WRITES;
+    MEMORY_BUS BUS;
+    WRITES = 0;
+
+    CHECK(BUS.MAP_ARRAY(0x000000, 0x00FFFF, RAM, true));
+    CHECK(!BUS.MAP_HANDLER(0x001008, 0x0010FF, &WRITES, FUJIKO_HANDLER<U8>{ TEST_READ_8, TEST_COUNT_WRITE }));
+    CHECK(BUS.MAP_HANDLER(0x001000, 0x0010FF, &WRITES, FUJIKO_HANDLER<U8>{ TEST_READ_8, TEST_COUNT_WRITE }));
+
+    BUS.WRITE<U32>(0x000FF0, 0x12345678);
+    CHECK(RAM[0x0FF0] == 0x78 || RAM[0x0FF0] == 0x12);
+    CHECK(BUS.READ<U32>(0x000FF0) == 0x12345678);
+    CHECK(BUS.READ<U8>(0x001042) == 0x42);
+
+    BUS.WRITE<U8>(0x001000, 0xFF);
+    CHECK(WRITES == 1);
+    CHECK(RAM[0x1000] == 0x00);
+
+    // AN ACCESS STRADDLING RAM AND THE DEVICE IS SPLIT BETWEEN THE TWO
+    RAM[0x0FFF] = 0xAA;
+    const U16 EDGE = BUS.READ<U16>(0x000FFF);
+    CHECK((EDGE & 0xFF) == 0xAA || (EDGE >> 8) == 0xAA);
+    BUS.WRITE<U16>(0x000FFF, 0);
+    CHECK(RAM[0x0FFF] == 0x00 && WRITES == 2);
+
+    // A SMALL SRAM LAID OVER THE MIDDLE OF THE DEVICE
+    CHECK(BUS.MAP_REGION(0x001040, 0x00105F, SRAM));
+    BUS.WRITE<U8>(0x001041, 0x77);
+    CHECK(SRAM[1] == 0x77 && WRITES == 2);
+    CHECK(BUS.READ<U8>(0x001041) == 0x77);
+    CHECK(BUS.READ<U8>(0x001060) == 0x60);
+
+    // RAM WITHIN THE SPLIT IS STILL ROLLED BACK BY A SNAPSHOT
+    CHECK(BUS.ENABLE_TRACKING(6));
+    const U32 BEFORE = BUS.SNAPSHOT();
+    BUS.WRITE<U32>(0x00104E, 0xDEADBEEF);
+    BUS.WRITE<U8>(0x001041, 0x11);
+    CHECK(BUS.IS_DIRTY(0x001041) && BUS.IS_DIRTY(0x001050));
+    CHECK(BUS.RESTORE(BEFORE));
+    CHECK(SRAM[1] == 0x77 && SRAM[0x0E] == 0 && SRAM[0x11] == 0);
+    BUS.DISABLE_TRACKING();
+
+    // EVERY SPLIT A LATER ONE REPLACES IS FREED, ALONG WITH ANY RECORD NOTHING ELSE HOLDS
+    for(U32 REMAP = 0; REMAP < 100; REMAP++)
+        CHECK(BUS.MAP_HANDLER(0x001100, 0x00110F, &WRITES, FUJIKO_HANDLER<U8>{ TEST_READ_8, TEST_COUNT_WRITE }));
+
+    CHECK(BUS.OWNED_COUNT() == 3);
+
+    // REMAPPING THE WHOLE PAGE DISCARDS THE SPLIT
+    CHECK(BUS.MAP_ARRAY(0x000000, 0x00FFFF, RAM, true));
+    CHECK(BUS.READ<U8>(0x001000) == RAM[0x1000]);
+    CHECK(BUS.OWNED_COUNT() == 0);
+}
+
+// BYTE ORDER HELPERS, AND A BIG-ENDIAN BUS WHICH HOLDS GUEST MEMORY MOST SIGNIFICANT BYTE FIRST
+static void TEST_ENDIAN(void)
+{
+    static_assert(fujiko::bits::BSWAP<U16>(0x1234) == 0x3412);
+    static_assert(fujiko::bits::BSWAP<U32>(0x12345678) == 0x78563412);
+    static_assert(fujiko::bits::EXTRACT<11, 8>(0x0F00U) == 0xF);
+    static_assert(fujiko::bits::SIGN_EXTEND<16>(0xFFFE) == -2);
+    static_assert(fujiko::bits::ROTL<U8>(0x81, 1) == 0x03);
+    static_assert(fujiko::bits::CLZ<U16>(1) == 15 && fujiko::bits::CTZ<U32>(0x100) == 8);
+
+    alignas(64) static std::array<U8, 0x20000> RAM;
+    BASIC_MEMORY_BUS<24, 16, FUJIKO_ENDIAN_BIG> BUS;
+    CHECK(BUS.MAP_ARRAY(0x000000, 0x01FFFF, RAM, true));
+
+    BUS.WRITE<U32>(0x000100, 0x12345678);
+    CHECK(RAM[0x100] == 0x12 && RAM[0x103] == 0x78);
+    CHECK(BUS.READ<U16>(0x000102) == 0x5678);
+    CHECK(fujiko::bits::LOAD_BIG<U32>(RAM.data() + 0x100) == 0x12345678);
+
+    // ACROSS A PAGE BOUNDARY
+    BUS.WRITE<U32>(0x00FFFE, 0xAABBCCDD);
+    CHECK(RAM[0xFFFE] == 0xAA && RAM[0x10001] == 0xDD);
+    CHECK(BUS.READ<U32>(0x00FFFE) == 0xAABBCCDD);
+
+    // TYPED BLOCKS LONG ENOUGH TO TAKE BOTH THE VECTOR AND SCALAR PATHS
+    U16 WORDS[37];
+    U16 BACK[37] = {};
+    for(U32 INDEX = 0; INDEX < 37; INDEX++)
+        WORDS[INDEX] = static_cast<U16>(0x0100 * INDEX + INDEX + 1);
+
+    BUS.WRITE_BLOCK(0x000200, WORDS, 37);
+    CHECK(RAM[0x200] == 0x00 && RAM[0x201] == 0x01 && RAM[0x248] == 0x24);
+    BUS.READ_BLOCK(0x000200, BACK, 37);
+    CHECK(std::memcmp(WORDS, BACK, sizeof(WORDS)) == 0);
+
+    U32 LONGS[19];
+    for(U32 INDEX = 0; INDEX < 19; INDEX++)
+        LONGS[INDEX] = 0x01020304U * (INDEX + 1);
+
+    fujiko::bits::SWAP_BLOCK(LONGS, LONGS, 19);
+    CHECK(LONGS[18] == fujiko::bits::BSWAP(0x01020304U * 19));
+}
+
+// PER-PAGE COUNTERS AND THE TRACE RING - ONLY BUILT INTO NOODLE_PROFILE BUILDS
+static void TEST_PROFILE(void)
+{
+    alignas(64) static std::array<U8, 0x20000> RAM;
+    MEMORY_BUS BUS;
+    CHECK(BUS.MAP_ARRAY(0x000000, 0x01FFFF, RAM, true));
+
+#if NOODLE_BUS_PROFILE
+    CHECK(!BUS.START_PROFILE(3));
+    CHECK(BUS.START_PROFILE(4));
+
+    BUS.WRITE<U32>(0x010000, 0xDEADBEEF);
+    CHECK(BUS.READ<U32>(0x010000) == 0xDEADBEEF);
+    BUS.READ<U8>(0x010001);
+    BUS.FETCH<U16>(0x000000);
+    BUS.READ<U16>(0x000002);
+    BUS.READ<U16>(0x010002);
+
+    const std::vector<FUJIKO_PAGE_HEAT> HEAT = BUS.HEATMAP();
+    CHECK(HEAT.size() == 2);
+    CHECK(HEAT[0].BASE == 0x010000 && HEAT[0].TOTAL() == 4);
+    CHECK(HEAT[0].WRITES[2] == 1 && HEAT[0].READS[2] == 1 && HEAT[0].READS[0] == 1);
+    CHECK(HEAT[1].BASE == 0x000000 && HEAT[1].READS[1] == 2);
+
+    // THE RING ONLY HOLDS THE LAST FOUR, OLDEST FIRST
+    const std::vector<FUJIKO_TRACE_RECORD> TRACE = BUS.TRACE();
+    CHECK(TRACE.size() == 4);
+    CHECK(TRACE[0].ADDRESS == 0x010001 && TRACE[0].SIZE == 1);
+    CHECK(TRACE[1].ACCESS == watch::EXECUTE);
+    CHECK(TRACE[3].ADDRESS == 0x010002 && TRACE[3].VALUE == 0xDEAD);
+
+    char PATH[] = "/tmp/noodle_traceXXXXXX";
+    const int FD = ::mkstemp(PATH);
+    ::close(FD);
+
+    CHECK(BUS.DUMP_TRACE(PATH));
+    std::FILE* FILE = std::fopen(PATH, "rb");
+    U8 HEADER[12 + 10] = {};
+    CHECK(FILE != nullptr && std::fread(HEADER, 1, sizeof(HEADER), FILE) == sizeof(HEADER));
+    std::fclose(FILE);
+    ::unlink(PATH);
+
+    CHECK(std::memcmp(HEADER, "NTRC", 4) == 0);
+    CHECK(fujiko::bits::LOAD_LITTLE<U32>(HEADER + 8) == 4);
+    CHECK(fujiko::bits::LOAD_LITTLE<U32>(HEADER + 12) == 0x010001);
+
+    BUS.STOP_PROFILE();
+    CHECK(BUS.HEATMAP().empty());
+
+    // ON A SHARED BUS A STOPPED PROFILE WAITS FOR THE READERS, RATHER THAN BEING FREED UNDER THEM
+    BASIC_MEMORY_BUS<20, 12, FUJIKO_ENDIAN_NATIVE, FUJIKO_SYNC_SHARED> SHARED;
+    const U32 SLOT = SHARED.PAGES.REGISTER_READER();
+    CHECK(SHARED.START_PROFILE());
+    SHARED.STOP_PROFILE();
+    CHECK(!SHARED.PROFILING() && SHARED.PAGES.RETIRED() == 1);
+    SHARED.PAGES.QUIESCENT(SLOT);
+    SHARED.PAGES.RECLAIM();
+    CHECK(SHARED.PAGES.RETIRED() == 0);
+    SHARED.PAGES.UNREGISTER_READER(SLOT);
+#else
+    CHECK(!BUS.START_PROFILE());
+    CHECK(!BUS.PROFILING() && BUS.HEATMAP().empty());
+    CHECK(!BUS.DUMP_TRACE("/dev/null"));
+#endif
+}
+
+// COUNT HOW MANY TIMES A STRING APPEARS IN A LOG WRITTEN OUT TO A TEMPORARY FILE
+static U32 TEST_LOG_COUNT(std::FILE* FILE, const char* NEEDLE)
+{
+    std::string TEXT;
+    char CHUNK[4096];
+    std::rewind(FILE);
+
+    for(std::size_t READ; (READ = std::fread(CHUNK, 1, sizeof(CHUNK), FILE)) > 0;)
+        TEXT.append(CHUNK, READ);
+
+    U32 COUNT = 0;
+    for(std::size_t POS = TEXT.find(NEEDLE); POS != std::string::npos; POS = TEXT.find(NEEDLE, POS + 1))
+        COUNT++;
+
+    return COUNT;
+}
+
+// HOW MANY DISTINCT CODES THE MESSAGES IN A LOG FILE WERE WRITTEN UNDER
+static U32 TEST_LOG_CODES(std::FILE* FILE)
+{
+    std::set<U64> CODES;
+    char LINE[512];
+    std::rewind(FILE);
+
+    while(std::fgets(LINE, sizeof(LINE), FILE))
+    {
+        unsigned long long CODE = 0;
+        if(std::sscanf(LINE, "ERROR: %llu -", &CODE) == 1)
+            CODES.insert(CODE);
+    }
+
+    return static_cast<U32>(CODES.size());
+}
+
+// MESSAGES FROM SEVERAL THREADS ARE HANDED OFF TO THE BACKGROUND WRITER, WITH OVERFLOW HANDLED BY POLICY
+static void TEST_ASYNC_LOG(void)
+{
+    using namespace noodle::err;
+    ASYNC_LOG& LOG = ASYNC_LOG::INSTANCE();
+
+    for(const LOG_OVERFLOW POLICY : { LOG_OVERFLOW::BLOCK, LOG_OVERFLOW::COUNT })
+    {
+        std::FILE* FILE = std::tmpfile();
+        CHECK(!LOG.START(LOG_CONFIG{ 3, POLICY, FILE }));
+        CHECK(LOG.START(LOG_CONFIG{ 4, POLICY, FILE }));
+
+        std::vector<std::thread> THREADS;
+        for(U32 THREAD = 0; THREAD < 2; THREAD++)
+        {
+            THREADS.emplace_back([THREAD]
+            {
+                for(U32 INDEX = 0; INDEX < 200; INDEX++)
+                    NOODLE_WARNING("ASYNC {} {}", THREAD, INDEX);
+            });
+        }
+
+        for(std::thread& THREAD : THREADS)
+            THREAD.join();
+
+        LOG.FLUSH();
+        LOG.STOP();
+
+        const U32 WRITTEN = TEST_LOG_COUNT(FILE, "- ASYNC");
+
+        if(POLICY == LOG_OVERFLOW::BLOCK)
+            CHECK(WRITTEN == 400 && LOG.DROPPED() == 0);
+        else
+        {
+            CHECK(WRITTEN + LOG.DROPPED() == 400);
+            CHECK((LOG.DROPPED() == 0) == (TEST_LOG_COUNT(FILE, "MESSAGES DROPPED") == 0));
+        }
+
+        std::fclose(FILE);
+    }
+
+    // LONG MESSAGES ARE TRUNCATED TO A SLOT
+    std::FILE* FILE = std::tmpfile();
+    CHECK(LOG.START(LOG_CONFIG{ 16, LOG_OVERFLOW::BLOCK, FILE }));
+    NOODLE_INFO("{}", std::string(1000, 'X'));
+    NOODLE_FATAL("FLUSHED BEFORE RETURNING");
+    CHECK(TEST_LOG_COUNT(FILE, "FLUSHED BEFORE RETURNING") == 1);
+    CHECK(TEST_LOG_COUNT(FILE, "X") == ASYNC_LOG::MESSAGE_SIZE);
+
+    // STRINGS ARE COPIED, SO THE WORKER NEVER SEES A TEMPORARY WHICH HAS GONE, NOR READS THROUGH A NULL ONE -
+    // AND A MESSAGE WHICH FAILS TO FORMAT IS STILL PUBLISHED, RATHER THAN STALLING EVERYTHING BEHIND IT
+    NOODLE_WARNING("DEFERRED {} {}", std::string("TEMPORARY"), 0x10);
+    NOODLE_WARNING("BAD WIDTH {:{}}", 1, -1);
+    NOODLE_WARNING("DEVICE {} MISSING", static_cast<const char*>(nullptr));
+    NOODLE_FATAL("AFTER THE BAD WIDTH");
+    CHECK(TEST_LOG_COUNT(FILE, "DEFERRED TEMPORARY 16") == 1);
+    CHECK(TEST_LOG_COUNT(FILE, "DEVICE (NULL) MISSING") == 1);
+    CHECK(TEST_LOG_COUNT(FILE, "<FORMAT ERROR") == 1);
+    CHECK(TEST_LOG_COUNT(FILE, "AFTER THE BAD WIDTH") == 1);
+    LOG.STOP();
+    std::fclose(FILE);
+
+    // STOPPING AND STARTING UNDER LOGGING THREADS - A MESSAGE IS EITHER PUSHED OR WRITTEN SYNCHRONOUSLY, NEVER LOST
+    FILE = std::tmpfile();
+    SET_LOG_OUTPUT(FILE);
+    std::atomic<bool> DONE{false};
+    std::vector<std::thread> THREADS;
+
+    for(U32 THREAD = 0; THREAD < 2; THREAD++)
+    {
+        THREADS.emplace_back([THREAD]
+        {
+            for(U32 INDEX = 0; INDEX < 2000; INDEX++)
+                NOODLE_WARNING("RESTART {} {}", THREAD, INDEX);
+        });
+    }
+
+    std::thread RESTARTER([&]
+    {
+        while(!DONE.load())
+        {
+            LOG.START(LOG_CONFIG{ 8, LOG_OVERFLOW::BLOCK, FILE });
+            LOG.STOP();
+        }
+    });
+
+    for(std::thread& THREAD : THREADS)
+        THREAD.join();
+
+    DONE.store(true);
+    RESTARTER.join();
+    std::fflush(FILE);
+
+    CHECK(TEST_LOG_COUNT(FILE, "- RESTART") == 4000);
+    SET_LOG_OUTPUT(nullptr);
+    std::fclose(FILE);
+}
+
+// FILTERED MESSAGES NEVER EVALUATE THEIR ARGUMENTS, WHETHER REMOVED AT COMPILE TIME OR SKIPPED AT RUNTIME
+static U32 TEST_LOG_EVALUATED = 0;
+
+static U32 TEST_LOG_ARGUMENT(void)
+{
+    return ++TEST_LOG_EVALUATED;
+}
+
+static void TEST_LOG_LEVEL(void)
+{
+    using namespace noodle::err;
+
+    std::FILE* FILE = std::tmpfile();
+    SET_LOG_OUTPUT(FILE);
+
+    SET_LOG_LEVEL(ERROR_SEVERITY::WARNING);
+    NOODLE_INFO("SKIPPED {}", TEST_LOG_ARGUMENT());
+    NOODLE_WARNING("KEPT {}", TEST_LOG_ARGUMENT());
+    CHECK(TEST_LOG_EVALUATED == 1);
+    SET_LOG_LEVEL(ERROR_SEVERITY::INFO);
+
+    #pragma push_macro("NOODLE_LOG_LEVEL")
+    #undef NOODLE_LOG_LEVEL
+    #define NOODLE_LOG_LEVEL 2
+    NOODLE_WARNING("REMOVED {}", TEST_LOG_ARGUMENT());
+    NOODLE_ERROR("KEPT {}", TEST_LOG_ARGUMENT());
+    #pragma pop_macro("NOODLE_LOG_LEVEL")
+
+    CHECK(TEST_LOG_EVALUATED == 2);
+    std::fflush(FILE);
+    CHECK(TEST_LOG_COUNT(FILE, "KEPT") == 2 && TEST_LOG_COUNT(FILE, "SKIPPED") == 0 && TEST_LOG_COUNT(FILE, "REMOVED") == 0);
+    CHECK(TEST_LOG_COUNT(FILE, "[WARNING] [CUSTOM]") == 1 && TEST_LOG_COUNT(FILE, "[ERROR] [CUSTOM]") == 1);
+
+    SET_LOG_OUTPUT(nullptr);
+    std::fclose(FILE);
+}
+
+// BINARY RECORDS FROM SEVERAL THREADS, RENDERED BACK TO TEXT AFTERWARDS
+static void TEST_BINARY_LOG(void)
+{
+    using namespace noodle::err;
+    BINARY_LOG& LOG = BINARY_LOG::INSTANCE();
+
+    char PATH[] = "/tmp/noodle_binlogXXXXXX";
+    ::close(::mkstemp(PATH));
+
+    CHECK(LOG.OPEN(PATH, 0x100000));
+    CHECK(!LOG.OPEN(PATH));
+
+    std::vector<std::thread> THREADS;
+    for(U32 THREAD = 0; THREAD < 2; THREAD++)
+    {
+        THREADS.emplace_back([THREAD]
+        {
+            for(U32 INDEX = 0; INDEX < 100; INDEX++)
+                NOODLE_BINARY_PRINT(ERROR_CATEGORY::RUNTIME_ERR, ERROR_SEVERITY::WARNING, "BINARY {} 0x{:04X}", THREAD, INDEX);
+        });
+    }
+
+    for(std::thread& THREAD : THREADS)
+        THREAD.join();
+
+    const std::string OWNED = "OWNED";
+    NOODLE_BINARY_PRINT(ERROR_CATEGORY::CUSTOM_ERR, ERROR_SEVERITY::INFO, "MIXED {} {} {:.2f} {} {} {} {}",
+                        S16{-5}, 'Q', 2.5, "TEXT", OWNED, U8{3}, true);
+    NOODLE_BINARY_PRINT(ERROR_CATEGORY::CUSTOM_ERR, ERROR_SEVERITY::STD_ERROR, "NO ARGUMENTS");
+
+    LOG.CLOSE();
+    CHECK(LOG.DROPPED() == 0);
+
+    std::FILE* FILE = std::tmpfile();
+    CHECK(DECODE_LOG(PATH, FILE));
+    std::fflush(FILE);
+
+    CHECK(TEST_LOG_COUNT(FILE, "- BINARY 0 0x") == 100 && TEST_LOG_COUNT(FILE, "- BINARY 1 0x") == 100);
+    CHECK(TEST_LOG_COUNT(FILE, "BINARY 1 0x0063") == 1);
+    CHECK(TEST_LOG_COUNT(FILE, "[WARNING] [RUNTIME]") == 200);
+    CHECK(TEST_LOG_COUNT(FILE, "MIXED -5 Q 2.50 TEXT OWNED 3 true") == 1);
+    CHECK(TEST_LOG_COUNT(FILE, "- NO ARGUMENTS") == 1);
+    CHECK(TEST_LOG_COUNT(FILE, "tests/memory.cc:") == 202);
+
+    std::fclose(FILE);
+    ::unlink(PATH);
+
+    // A FULL LOG DROPS AND COUNTS RATHER THAN OVERRUNNING - EACH RECORD HERE BEING 20 BYTES
+    CHECK(LOG.OPEN(PATH, 64));
+    for(U32 INDEX = 0; INDEX < 4; INDEX++)
+        NOODLE_BINARY_PRINT(ERROR_CATEGORY::CUSTOM_ERR, ERROR_SEVERITY::INFO, "FULL {}", INDEX);
+
+    LOG.CLOSE();
+    CHECK(LOG.DROPPED() == 1);
+
+    FILE = std::tmpfile();
+    CHECK(DECODE_LOG(PATH, FILE));
+    std::fflush(FILE);
+    CHECK(TEST_LOG_COUNT(FILE, "- FULL") == 3 && TEST_LOG_COUNT(FILE, "1 MESSAGES DROPPED") == 1);
+    std::fclose(FILE);
+
+    // CLOSING UNDER LOGGING THREADS - A MESSAGE LANDS IN THE FILE, FALLS BACK TO TEXT OR IS COUNTED AS DROPPED,
+    // BUT IS NEVER WRITTEN INTO A FILE WHICH HAS GONE
+    char RACED[] = "/tmp/noodle_racedXXXXXX";
+    ::close(::mkstemp(RACED));
+
+    std::FILE* TEXT = std::tmpfile();
+    SET_LOG_OUTPUT(TEXT);
+    CHECK(LOG.OPEN(RACED, 0x100000));
+
+    std::atomic<U32> STARTED{0};
+    THREADS.clear();
+
+    for(U32 THREAD = 0; THREAD < 2; THREAD++)
+    {
+        THREADS.emplace_back([THREAD, &STARTED]
+        {
+            for(U32 INDEX = 0; INDEX < 2000; INDEX++)
+            {
+                NOODLE_BINARY_PRINT(ERROR_CATEGORY::RUNTIME_ERR, ERROR_SEVERITY::WARNING, "RACING {} {}", THREAD, INDEX);
+                if(INDEX == 100) STARTED.fetch_add(1);
+            }
+        });
+    }
+
+    while(STARTED.load() < 2)
+        std::this_thread::yield();
+
+    LOG.CLOSE();
+
+    for(std::thread& THREAD : THREADS)
+        THREAD.join();
+
+    SET_LOG_OUTPUT(nullptr);
+    FILE = std::tmpfile();
+    CHECK(DECODE_LOG(RACED, FILE));
+    std::fflush(FILE);
+    std::fflush(TEXT);
+    CHECK(TEST_LOG_COUNT(FILE, "- RACING") + TEST_LOG_COUNT(TEXT, "- RACING") + LOG.DROPPED() == 4000);
+    std::fclose(FILE);
+    std::fclose(TEXT);
+    ::unlink(RACED);
+
+    // A DAMAGED FILE IS REJECTED RATHER THAN READ PAST IT'S END, AND A FORMAT WHICH NO LONGER FITS IT'S
+    // ARGUMENTS IS WRITTEN AS A MARKER
+    std::vector<U8> ORIGINAL;
+    FILE = std::fopen(PATH, "rb");
+    for(int BYTE; (BYTE = std::fgetc(FILE)) != EOF;) ORIGINAL.push_back(static_cast<U8>(BYTE));
+    std::fclose(FILE);
+
+    BINARY_LOG_HEADER HEADER;
+    std::memcpy(&HEADER, ORIGINAL.data(), sizeof(HEADER));
+    const std::size_t SITE_FORMAT = std::search(ORIGINAL.begin(), ORIGINAL.end(), "FULL {}", "FULL {}" + 7) - ORIGINAL.begin();
+
+    const auto DECODES = [&](const std::vector<U8>& DAMAGED, const char* NEEDLE)
+    {
+        FILE = std::fopen(PATH, "wb");
+        std::fwrite(DAMAGED.data(), 1, DAMAGED.size(), FILE);
+        std::fclose(FILE);
+
+        std::FILE* TEXT = std::tmpfile();
+        const bool DECODED = DECODE_LOG(PATH, TEXT);
+        std::fflush(TEXT);
+        const U32 COUNT = TEST_LOG_COUNT(TEXT, NEEDLE);
+        std::fclose(TEXT);
+        return DECODED ? COUNT : ~0U;
+    };
+
+    std::vector<U8> DAMAGED = ORIGINAL;
+    std::memcpy(DAMAGED.data() + SITE_FORMAT, "F{:.1f}", 7);
+    CHECK(DECODES(DAMAGED, "<FORMAT ERROR") == 3);
+
+    DAMAGED = ORIGINAL;
+    DAMAGED[SITE_FORMAT - 2] = DAMAGED[SITE_FORMAT - 1] = 0xFF;
+    CHECK(DECODES(DAMAGED, "- FULL") == ~0U);
+
+    DAMAGED = ORIGINAL;
+    DAMAGED[HEADER.RECORDS_OFFSET + 4] = 3;
+    CHECK(DECODES(DAMAGED, "- FULL") == ~0U);
+
+    DAMAGED = ORIGINAL;
+    DAMAGED[HEADER.RECORDS_OFFSET + 5] = 0xFF;
+    CHECK(DECODES(DAMAGED, "- FULL") == ~0U);
+
+    ::unlink(PATH);
+}
+
+// COUNTS FROM EVERY THREAD LAND IN ONE REGISTRY, AND A REPEATING MESSAGE IS COLLAPSED WITHIN IT'S WINDOW
+static void TEST_METRICS(void)
+{
+    using namespace noodle::err;
+    ERROR_METRICS& METRICS = ERROR_METRICS::INSTANCE();
+
+    std::FILE* FILE = std::tmpfile();
+    SET_LOG_OUTPUT(FILE);
+    METRICS.RESET();
+
+    // TWO ROUNDS, SO THE SECOND SET OF THREADS PICKS UP THE SHARDS THE FIRST LEFT BEHIND
+    for(U32 ROUND = 0; ROUND < 2; ROUND++)
+    {
+        std::vector<std::thread> THREADS;
+        for(U32 THREAD = 0; THREAD < 4; THREAD++)
+        {
+            THREADS.emplace_back([THREAD]
+            {
+                for(U32 INDEX = 0; INDEX < 125; INDEX++)
+                    NOODLE_RESOURCE_ERROR("METRIC {} {}", THREAD, INDEX);
+            });
+        }
+
+        for(std::thread& THREAD : THREADS)
+            THREAD.join();
+    }
+
+    NOODLE_INFO("METRIC DONE");
+
+    // EVERY MESSAGE WRITTEN CARRIES IT'S OWN CODE, WHICHEVER THREAD OR SHARD IT CAME FROM
+    std::fflush(FILE);
+    CHECK(TEST_LOG_CODES(FILE) == 1001);
+
+    METRICS_SNAPSHOT SNAPSHOT = METRICS.SNAPSHOT();
+    CHECK(SNAPSHOT.COUNT(ERROR_CATEGORY::RES_ERR, ERROR_SEVERITY::STD_ERROR) == 1000);
+    CHECK(SNAPSHOT.SEVERITY(ERROR_SEVERITY::INFO) == 1 && SNAPSHOT.CATEGORY(ERROR_CATEGORY::CUSTOM_ERR) == 1);
+    CHECK(SNAPSHOT.TOTAL() == 1001 && SNAPSHOT.SUPPRESSED == 0);
+    CHECK(SNAPSHOT.JSON() == "{\"total\":1001,\"suppressed\":0,\"counts\":{\"RESOURCE\":{\"ERROR\":1000},\"CUSTOM\":{\"INFO\":1}}}");
+    CHECK(SNAPSHOT.TEXT() == "[ERROR] [RESOURCE] 1000\n[INFO] [CUSTOM] 1\nTOTAL: 1001 SUPPRESSED: 0\n");
+
+    // THE SAME FAULT FROM A HOT LOOP IS WRITTEN ONCE, THEN SUMMARISED BY THE NEXT DIFFERENT MESSAGE
+    SET_LOG_REPEAT_WINDOW(std::chrono::hours(1));
+
+    for(U32 INDEX = 0; INDEX < 100; INDEX++)
+        NOODLE_WARNING("REPEATED FAULT AT 0x{:X}", 0x1234);
+
+    NOODLE_WARNING("DIFFERENT FAULT");
+    SET_LOG_REPEAT_WINDOW(std::chrono::nanoseconds(0));
+
+    std::fflush(FILE);
+    CHECK(TEST_LOG_COUNT(FILE, "REPEATED FAULT AT 0x1234") == 1);
+    CHECK(TEST_LOG_COUNT(FILE, "LAST MESSAGE REPEATED 99 TIMES") == 1);
+    CHECK(TEST_LOG_COUNT(FILE, "DIFFERENT FAULT") == 1);
+
+    SNAPSHOT = METRICS.SNAPSHOT();
+    CHECK(SNAPSHOT.SEVERITY(ERROR_SEVERITY::WARNING) == 101 && SNAPSHOT.SUPPRESSED == 99);
+
+    METRICS.RESET();
+    CHECK(METRICS.SNAPSHOT().TOTAL() == 0);
+
+    // A REPEAT IS KNOWN BY IT'S ARGUMENTS BEFORE ANYTHING IS FORMATTED - STRINGS BY THEIR CONTENTS
+    SET_LOG_REPEAT_WINDOW(std::chrono::hours(1));
+
+    for(U32 INDEX = 0; INDEX < 10; INDEX++)
+        NOODLE_WARNING("KEYED FAULT IN {}", std::string(INDEX < 5 ? "ALPHA" : "BRAVO"));
+
+    // ONCE A THREAD EXITS, IT'S PENDING COUNT IS REPORTED WITHOUT ANOTHER MESSAGE
+    std::thread([] { for(U32 INDEX = 0; INDEX < 6; INDEX++) NOODLE_WARNING("EXITING FAULT"); }).join();
+
+    // AS IS ONE WHICH OUTLIVES IT'S WINDOW
+    SET_LOG_REPEAT_WINDOW(std::chrono::milliseconds(20));
+
+    for(U32 INDEX = 0; INDEX < 8; INDEX++)
+        NOODLE_WARNING("EXPIRED FAULT");
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    std::fflush(FILE);
+
+    CHECK(TEST_LOG_COUNT(FILE, "KEYED FAULT IN ALPHA") == 1 && TEST_LOG_COUNT(FILE, "KEYED FAULT IN BRAVO") == 1);
+    CHECK(TEST_LOG_COUNT(FILE, "LAST MESSAGE REPEATED 4 TIMES") == 2);
+    CHECK(TEST_LOG_COUNT(FILE, "LAST MESSAGE REPEATED 5 TIMES") == 1);
+    CHECK(TEST_LOG_COUNT(FILE, "LAST MESSAGE REPEATED 7 TIMES") == 1);
+    CHECK(METRICS.SNAPSHOT().SUPPRESSED == 4 + 4 + 5 + 7);
+
+    // NOTHING IS REPORTED TWICE WHEN THE WINDOW IS CLEARED
+    SET_LOG_REPEAT_WINDOW(std::chrono::nanoseconds(0));
+    std::fflush(FILE);
+    CHECK(TEST_LOG_COUNT(FILE, "LAST MESSAGE REPEATED 7 TIMES") == 1);
+
+    SET_LOG_OUTPUT(nullptr);
+    std::fclose(FILE);
+}
+
+// A MAPPING HELPER WHICH HANDS ANY FAILURE STRAIGHT BACK TO IT'S CALLER
+static RESULT<U32> TEST_MAP_AND_READ(MEMORY_BUS& BUS, U32 START, U32 END, std::array<U8, 0x10000>& RAM)
+{
+    NOODLE_TRY(BUS.MAP_ARRAY(START, END, RAM, true));
+    NOODLE_TRY_ASSIGN(const U32 VALUE, BUS.TRY_READ<U32>(START));
+    return VALUE + 1;
+}
+
+// MAPPING ERRORS AND BUS FAULTS ARRIVE AS VALUES, FORMATTED ONLY ON REQUEST
+static void TEST_RESULT(void)
+{
+    using noodle::err::ERROR_SEVERITY;
+
+    static_assert(sizeof(RESULT<U32>) == 3 * sizeof(U64) && sizeof(RESULT<void>) == 3 * sizeof(U64), "A RESULT SHOULD BE THREE WORDS");
+
+    alignas(64) static std::array<U8, 0x10000> RAM;
+    MEMORY_BUS BUS;
+
+    // PAST THE END OF THE 27-BIT ADDRESS SPACE - PREVIOUSLY AN OVERRUN OF THE PAGE TABLE
+    const RESULT<void> OUTSIDE = BUS.MAP_ARRAY(0x07FF0000, 0x0800FFFF, RAM, true);
+    CHECK(!OUTSIDE && OUTSIDE.ERROR().CATEGORY() == ERROR_CATEGORY::OOB && OUTSIDE.ERROR().CODE() == 0x07FF0000);
+    CHECK(OUTSIDE.ERROR().SEVERITY() == ERROR_SEVERITY::STD_ERROR);
+    CHECK(OUTSIDE.ERROR().MESSAGE() == "MAP_BUFFER: 0x07FF0000-0x0800FFFF IS NOT A RANGE WITHIN 0x00000000-0x07FFFFFF");
+    CHECK(!BUS.MAP_ARRAY(0x00020000, 0x0001FFFF, RAM, true));
+
+    const RESULT<void> UNALIGNED = BUS.MAP_HANDLER(0x00100008, 0x001000FF, nullptr, FUJIKO_HANDLER<U8>{});
+    CHECK(!UNALIGNED && UNALIGNED.ERROR().CATEGORY() == ERROR_CATEGORY::INVALID_ARG);
+
+    const RESULT<void> MISSING = BUS.MAP_IMAGE(0x00500000, 0x0050FFFF, "/nonexistent/noodle.bin", false);
+    CHECK(!MISSING && MISSING.ERROR().CATEGORY() == ERROR_CATEGORY::SYS_ERR && MISSING.ERROR().CODE() == ENOENT);
+    CHECK(MISSING.ERROR().MESSAGE().find("/nonexistent/noodle.bin") != std::string::npos);
+
+    // PROPAGATION, BOTH OF A FAILED MAPPING AND OF A FAULT ON THE FIRST ACCESS
+    RAM[0] = 0x41;
+    const RESULT<U32> READ = TEST_MAP_AND_READ(BUS, 0x00000000, 0x0000FFFF, RAM);
+    CHECK(READ && READ.VALUE() == BUS.READ<U32>(0) + 1);
+    CHECK(TEST_MAP_AND_READ(BUS, 0x00000000, 0x0FFFFFFF, RAM).ERROR().CATEGORY() == ERROR_CATEGORY::OOB);
+
+    // AN UNMAPPED PAGE FAULTS, INCLUDING AN ACCESS WHICH ONLY STRADDLES INTO ONE
+    const RESULT<U16> FAULT = BUS.TRY_READ<U16>(0x00300000);
+    CHECK(!FAULT && FAULT.ERROR().CODE() == 0x00300000 && FAULT.VALUE_OR(0xDEAD) == 0xDEAD);
+    CHECK(FAULT.ERROR().MESSAGE() == "BUS: READ OF UNMAPPED ADDRESS 0x00300000");
+    CHECK(!BUS.TRY_WRITE<U32>(0x0000FFFE, 0x12345678));
+    CHECK(BUS.TRY_WRITE<U32>(0x0000FFF0, 0x12345678) && BUS.TRY_READ<U32>(0x0000FFF0).VALUE() == 0x12345678);
+
+    // ANYTHING NOT TRIVIALLY COPYABLE IS HELD ALONGSIDE THE ERROR
+    const RESULT<std::string> TEXT = std::string("NOODLE");
+    CHECK(TEXT && TEXT.VALUE() == "NOODLE");
+
+    const RESULT<std::string> NO_TEXT = noodle::err::MAKE_ERROR(ERROR_CATEGORY::RES_ERR, ERROR_SEVERITY::WARNING, FMT_STRING("NO TEXT IN {{{}}}"), 7);
+    CHECK(!NO_TEXT && NO_TEXT.ERROR().SEVERITY() == ERROR_SEVERITY::WARNING && NO_TEXT.ERROR().MESSAGE() == "NO TEXT IN {7}");
+
+    // AN ARGUMENT FMT ONLY REJECTS AT RUNTIME GIVES A MARKER RATHER THAN AN EXCEPTION, AND A NULL STRING IS NAMED AS SUCH
+    const RESULT<void> BAD = noodle::err::MAKE_ERROR(ERROR_CATEGORY::INVALID_ARG, FMT_STRING("WIDTH {:{}}"), 1, -1);
+    CHECK(!BAD && BAD.ERROR().MESSAGE().rfind("<FORMAT ERROR: ", 0) == 0);
+
+    const char* NOTHING = nullptr;
+    const RESULT<void> NAMED = noodle::err::MAKE_ERROR(ERROR_CATEGORY::NULL_PTR, FMT_STRING("NAMED {}"), NOTHING);
+    CHECK(!NAMED && NAMED.ERROR().MESSAGE() == "NAMED (NULL)");
+
+    // AN ERROR OWNS IT'S ARGUMENTS - IT OUTLIVES THE STRINGS IT WAS GIVEN, ANY NUMBER OF LATER ERRORS, AND THE THREAD WHICH RAISED IT
+    std::string PATH = std::string("/nonexistent/") + "temporary.bin";
+    const RESULT<void> GONE = BUS.MAP_IMAGE(0x00500000, 0x0050FFFF, PATH.c_str(), false);
+    PATH.assign(PATH.size(), 'X');
+
+    RESULT<void> ELSEWHERE;
+    std::thread([&ELSEWHERE] { ELSEWHERE = noodle::err::MAKE_ERROR(ERROR_CATEGORY::RES_ERR, FMT_STRING("FROM {}"), std::string("ANOTHER THREAD")); }).join();
+
+    for(U32 INDEX = 0; INDEX < 100; INDEX++)
+        CHECK(!BUS.TRY_READ<U8>(0x00300000 + INDEX));
+
+    CHECK(GONE.ERROR().CATEGORY() == ERROR_CATEGORY::SYS_ERR && GONE.ERROR().MESSAGE().find("/nonexistent/temporary.bin") != std::string::npos);
+    CHECK(ELSEWHERE.ERROR().CATEGORY() == ERROR_CATEGORY::RES_ERR && ELSEWHERE.ERROR().MESSAGE() == "FROM ANOTHER THREAD");
+    CHECK(FAULT.ERROR().MESSAGE() == "BUS: READ OF UNMAPPED ADDRESS 0x00300000");
+
+    // REPORTING GOES THROUGH THE USUAL LOG
+    std::FILE* FILE = std::tmpfile();
+    noodle::err::SET_LOG_OUTPUT(FILE);
+    CHECK(!FAULT.REPORT());
+    std::fflush(FILE);
+    CHECK(TEST_LOG_COUNT(FILE, "[ERROR] [OUT_OF_BOUNDS]") == 1 && TEST_LOG_COUNT(FILE, "UNMAPPED ADDRESS 0x00300000") == 1);
+    noodle::err::SET_LOG_OUTPUT(nullptr);
+    std::fclose(FILE);
+}
+
+int main(void)
+{
+    fmt::print("NOODLE - MEMORY BUS TEST\n");
+    MEMORY MEM;
+    MEMORY_BUS BUS;
+
+    MEM.MAP_MEMORY(BUS);
+    TEST_READ_WRITE(BUS);
+    TEST_HANDLERS(BUS);
+    TEST_GEOMETRY();
+    TEST_TLB(BUS);
+    TEST_MMU(BUS);
+    TEST_BLOCK(BUS);
+    TEST_MAPPED(BUS);
+    TEST_SNAPSHOT();
+    TEST_WATCH();
+    TEST_SHARED();
+    TEST_SPLIT();
+    TEST_ENDIAN();
+    TEST_PROFILE();
+    TEST_ASYNC_LOG();
+    TEST_LOG_LEVEL();
+    TEST_BINARY_LOG();
+    TEST_METRICS();
+    TEST_RESULT();
+
+    fmt::print("FAILURES: {}\n", FAILURES);
+    return FAILURES == 0 ? 0 : 1;
+}
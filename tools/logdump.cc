@@ -0,0 +1,37 @@
+// COPYRIGHT (C) HARRY CLARK 2025
+// A LIGHTWEIGHT IMPLEMENTATION OF COMMON UTILITIES
+
+// RENDERS A BINARY LOG WRITTEN THROUGH NOODLE::ERR::BINARY_LOG BACK TO TEXT
+// USAGE: NOODLE_LOGDUMP <LOG> [OUTPUT]
+
+// NESTED INCLUDES
+
+#include <noodle/binlog.hh>
+
+// SYSTEM INCLUDES
+
+#include <cstdio>
+
+int main(int argc, char** argv)
+{
+    if(argc < 2 || argc > 3)
+    {
+        fmt::print(stderr, "USAGE: {} <LOG> [OUTPUT]\n", argv[0]);
+        return 2;
+    }
+
+    std::FILE* OUTPUT = argc == 3 ? std::fopen(argv[2], "w") : stdout;
+
+    if(OUTPUT == nullptr)
+    {
+        fmt::print(stderr, "COULD NOT OPEN {}\n", argv[2]);
+        return 1;
+    }
+
+    const bool DECODED = noodle::err::DECODE_LOG(argv[1], OUTPUT);
+
+    if(OUTPUT != stdout)
+        std::fclose(OUTPUT);
+
+    return DECODED ? 0 : 1;
+}